@@ -462,6 +462,11 @@ if(lz4)
 else()
   set(haslz4compression undef)
 endif()
+if(zstd)
+  set(haszstdcompression define)
+else()
+  set(haszstdcompression undef)
+endif()
 if(cocoa)
   set(hascocoa define)
 else()
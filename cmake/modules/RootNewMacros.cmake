@@ -265,7 +265,7 @@ function(ROOT_GENERATE_DICTIONARY dictionary)
   # Replace the non-standard folder layout of Core.
   if (ARG_STAGE1 AND ARG_MODULE STREQUAL "Core")
     # FIXME: Glob these folders.
-    set(core_folders base clib clingutils cont dictgen doc foundation lzma lz4
+    set(core_folders base clib clingutils cont dictgen doc foundation lzma lz4 zstd
                      macosx meta metacling multiproc newdelete pcre rint
                      rootcling_stage1 textinput thread unix winnt zip)
     foreach(core_folder ${core_folders})
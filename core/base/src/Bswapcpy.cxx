@@ -0,0 +1,181 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Bulk byte swapping of arrays, see Bswapcpy.h.
+//
+// The x86-64 kernels swap 16 (SSSE3) or 32 (AVX2) bytes per instruction with
+// a byte shuffle; the best kernel available on the running CPU is selected on
+// first use. The remaining tail, and all other platforms, use the scalar loop,
+// written so that the compiler can recognize (and vectorize) the byte swaps.
+
+#include "Bswapcpy.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(__INTEL_COMPILER)
+#define R__BSWAPCPY_X86
+#include <immintrin.h>
+#endif
+
+typedef unsigned short R__uint16;
+typedef unsigned int R__uint32;
+typedef unsigned long long R__uint64;
+
+namespace {
+
+typedef void (*BswapKernel_t)(char *, const char *, size_t);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Portable byte swap of n elements of 2, 4 or 8 bytes.
+
+void SwapScalar16(char *to, const char *from, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      R__uint16 x;
+      memcpy(&x, from + 2 * i, 2);
+      x = (R__uint16)((x >> 8) | (x << 8));
+      memcpy(to + 2 * i, &x, 2);
+   }
+}
+
+void SwapScalar32(char *to, const char *from, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      R__uint32 x;
+      memcpy(&x, from + 4 * i, 4);
+      x = ((x & 0x000000ffU) << 24) | ((x & 0x0000ff00U) << 8) | ((x & 0x00ff0000U) >> 8) | ((x & 0xff000000U) >> 24);
+      memcpy(to + 4 * i, &x, 4);
+   }
+}
+
+void SwapScalar64(char *to, const char *from, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      R__uint64 x;
+      memcpy(&x, from + 8 * i, 8);
+      x = ((x & 0x00000000000000ffULL) << 56) | ((x & 0x000000000000ff00ULL) << 40) |
+          ((x & 0x0000000000ff0000ULL) << 24) | ((x & 0x00000000ff000000ULL) << 8) |
+          ((x & 0x000000ff00000000ULL) >> 8) | ((x & 0x0000ff0000000000ULL) >> 24) |
+          ((x & 0x00ff000000000000ULL) >> 40) | ((x & 0xff00000000000000ULL) >> 56);
+      memcpy(to + 8 * i, &x, 8);
+   }
+}
+
+#ifdef R__BSWAPCPY_X86
+
+////////////////////////////////////////////////////////////////////////////////
+/// Byte shuffle reversing each group of `size` bytes within 16 bytes.
+
+template <int size>
+struct ShuffleMask;
+template <>
+struct ShuffleMask<2> {
+   static const char *Get() { return "\1\0\3\2\5\4\7\6\11\10\13\12\15\14\17\16"; }
+};
+template <>
+struct ShuffleMask<4> {
+   static const char *Get() { return "\3\2\1\0\7\6\5\4\13\12\11\10\17\16\15\14"; }
+};
+template <>
+struct ShuffleMask<8> {
+   static const char *Get() { return "\7\6\5\4\3\2\1\0\17\16\15\14\13\12\11\10"; }
+};
+
+template <int size>
+__attribute__((target("ssse3"))) void SwapSSSE3(char *to, const char *from, size_t n)
+{
+   const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ShuffleMask<size>::Get()));
+   const size_t nbytes = n * size;
+   size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v, mask));
+   }
+   size_t done = i / size;
+   if (size == 2) SwapScalar16(to + i, from + i, n - done);
+   else if (size == 4) SwapScalar32(to + i, from + i, n - done);
+   else SwapScalar64(to + i, from + i, n - done);
+}
+
+template <int size>
+__attribute__((target("avx2"))) void SwapAVX2(char *to, const char *from, size_t n)
+{
+   // _mm256_shuffle_epi8 works within each 128 bit lane: use the same mask in both.
+   const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ShuffleMask<size>::Get()));
+   const __m256i mask = _mm256_broadcastsi128_si256(half);
+   const size_t nbytes = n * size;
+   size_t i = 0;
+   for (; i + 64 <= nbytes; i += 64) {
+      __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i));
+      __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i + 32), _mm256_shuffle_epi8(v1, mask));
+   }
+   for (; i + 32 <= nbytes; i += 32) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i), _mm256_shuffle_epi8(v, mask));
+   }
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v, half));
+   }
+   size_t done = i / size;
+   if (size == 2) SwapScalar16(to + i, from + i, n - done);
+   else if (size == 4) SwapScalar32(to + i, from + i, n - done);
+   else SwapScalar64(to + i, from + i, n - done);
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the fastest kernel for elements of `size` bytes on this CPU.
+
+template <int size>
+BswapKernel_t SelectKernel(BswapKernel_t scalar)
+{
+#ifdef R__BSWAPCPY_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2")) return &SwapAVX2<size>;
+   if (__builtin_cpu_supports("ssse3")) return &SwapSSSE3<size>;
+#endif
+   return scalar;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n 2-byte elements from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy16(void *to, const void *from, size_t n)
+{
+   static const BswapKernel_t kernel = SelectKernel<2>(&SwapScalar16);
+   kernel(static_cast<char *>(to), static_cast<const char *>(from), n);
+   return to;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n 4-byte elements from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy32(void *to, const void *from, size_t n)
+{
+   static const BswapKernel_t kernel = SelectKernel<4>(&SwapScalar32);
+   kernel(static_cast<char *>(to), static_cast<const char *>(from), n);
+   return to;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n 8-byte elements from `from` to `to`, swapping the bytes of each.
+
+void *bswapcpy64(void *to, const void *from, size_t n)
+{
+   static const BswapKernel_t kernel = SelectKernel<8>(&SwapScalar64);
+   kernel(static_cast<char *>(to), static_cast<const char *>(from), n);
+   return to;
+}
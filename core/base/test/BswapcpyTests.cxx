@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "Bswapcpy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Check every element size against a byte-by-byte reversal, for lengths around
+// the vector widths and with a misaligned source.
+TEST(Bswapcpy, Correctness)
+{
+   for (size_t n : {0, 1, 3, 7, 8, 15, 16, 17, 33, 64, 100, 1001}) {
+      std::vector<unsigned char> src(8 * n + 1), dst(8 * n);
+      for (size_t i = 0; i < src.size(); ++i)
+         src[i] = static_cast<unsigned char>(7 * i + 1);
+      for (size_t size : {2, 4, 8}) {
+         std::fill(dst.begin(), dst.end(), 0);
+         if (size == 2)
+            bswapcpy16(dst.data(), src.data() + 1, n);
+         else if (size == 4)
+            bswapcpy32(dst.data(), src.data() + 1, n);
+         else
+            bswapcpy64(dst.data(), src.data() + 1, n);
+         for (size_t e = 0; e < n; ++e)
+            for (size_t b = 0; b < size; ++b)
+               ASSERT_EQ(dst[e * size + b], src[1 + e * size + size - 1 - b]) << "n=" << n << " size=" << size;
+      }
+   }
+}
+
+// Conversion of a large array, as done when reading a basket.
+TEST(Bswapcpy, LargeArray)
+{
+   const size_t n = 1 << 20;
+   std::vector<float> from(n, 1.f), to(n);
+   bswapcpy32(to.data(), from.data(), n);
+   for (size_t i : {size_t(0), n / 2 + 1, n - 1}) {
+      unsigned int value;
+      memcpy(&value, &to[i], sizeof(value));
+      EXPECT_EQ(value, 0x0000803fU) << "element " << i; // 1.f is 0x3f800000
+   }
+}
+
+// Microbenchmark of the conversion throughput, which depends on the machine
+// and its load. Run with --gtest_also_run_disabled_tests.
+TEST(Bswapcpy, DISABLED_Throughput)
+{
+   const size_t n = 1 << 20;
+   const int nrepeat = 100;
+   std::vector<float> from(n, 1.f), to(n);
+   auto start = std::chrono::steady_clock::now();
+   for (int r = 0; r < nrepeat; ++r)
+      bswapcpy32(to.data(), from.data(), n);
+   auto stop = std::chrono::steady_clock::now();
+   double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+   printf("bswapcpy32: %.2f GB/s\n", nrepeat * n * sizeof(float) / ns);
+}
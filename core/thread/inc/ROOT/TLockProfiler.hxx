@@ -0,0 +1,74 @@
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TLockProfiler
+#define ROOT_TLockProfiler
+
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+ * \class ROOT::Experimental::TLockProfiler
+ * \brief Contention profiler for the global ROOT lock.
+ * \ingroup Multicore
+ *
+ * When enabled, ROOT::gCoreMutex (and gROOTMutex / gInterpreterMutex, which
+ * point to the same lock) is wrapped by an instrumented mutex that records,
+ * for each call site taking the lock through R__LOCKGUARD, R__READ_LOCKGUARD,
+ * R__WRITE_LOCKGUARD or TVirtualMutex::Lock(), the number of acquisitions,
+ * the time spent waiting for the lock and the time the lock was held.
+ * Optionally every acquisition is also recorded as an event, which can be
+ * written out in the Chrome trace format (chrome://tracing).
+ *
+ * A call site is the return address of the lock call, resolved to the
+ * enclosing function when the report is produced: the lock guards are
+ * inlined in optimized builds, hence this identifies the function that takes
+ * the lock.
+ *
+ * ~~~ {.cpp}
+ * ROOT::EnableImplicitMT();
+ * ROOT::Experimental::TLockProfiler::Enable(kTRUE);
+ * ... // run the workload
+ * ROOT::Experimental::TLockProfiler::Disable();
+ * ROOT::Experimental::TLockProfiler::Print();
+ * ROOT::Experimental::TLockProfiler::WriteChromeTrace("locks.json");
+ * ~~~
+ *
+ * Enable() and Disable() swap the global lock pointers: they should be
+ * called while no other thread is using ROOT.
+ */
+class TLockProfiler {
+public:
+   /// Counters of one call site; times are in seconds.
+   struct TCallSiteStats {
+      std::string fCallSite;      ///< Function (and library) taking the lock
+      ULong64_t fAcquisitions = 0; ///< Number of times the lock was taken
+      Double_t fWaitTime = 0.;    ///< Total time spent waiting for the lock
+      Double_t fMaxWaitTime = 0.; ///< Longest single wait
+      Double_t fHoldTime = 0.;    ///< Total time the lock was held
+   };
+
+   static void Enable(Bool_t traceEvents = kFALSE);
+   static void Disable();
+   static Bool_t IsEnabled();
+   static void Reset();
+
+   static std::vector<TCallSiteStats> GetStats();
+   static void Print(UInt_t nsites = 20);
+   static Bool_t WriteChromeTrace(const char *filename);
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
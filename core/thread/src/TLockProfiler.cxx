@@ -0,0 +1,493 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TLockProfiler                                                        //
+//                                                                      //
+// Records per call site wait and hold times of the global ROOT lock,   //
+// see ROOT/TLockProfiler.hxx.                                          //
+//                                                                      //
+// Each thread accumulates its counters in a thread local record,       //
+// protected by a mutex of its own that is only contended while a       //
+// report is produced: the instrumentation does not add a new point of  //
+// serialization. Records of threads that exit are merged into the      //
+// registry.                                                            //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "ROOT/TLockProfiler.hxx"
+
+#include "TError.h"
+#include "TInterpreter.h"
+#include "TROOT.h"
+#include "TString.h"
+#include "TVirtualRWMutex.h"
+#include "ThreadLocalStorage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <cxxabi.h>
+#include <dlfcn.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define R__LOCK_CALLSITE() __builtin_return_address(0)
+#else
+#define R__LOCK_CALLSITE() nullptr
+#endif
+
+namespace {
+
+/// Maximum number of trace events kept per thread.
+const std::size_t kMaxEventsPerThread = 1 << 18;
+
+Long64_t Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// Counters of one call site, times in nanoseconds.
+struct TSiteCounters {
+   ULong64_t fAcquisitions = 0;
+   Long64_t fWait = 0;
+   Long64_t fMaxWait = 0;
+   Long64_t fHold = 0;
+
+   void Add(const TSiteCounters &other)
+   {
+      fAcquisitions += other.fAcquisitions;
+      fWait += other.fWait;
+      fMaxWait = std::max(fMaxWait, other.fMaxWait);
+      fHold += other.fHold;
+   }
+};
+
+using SiteMap_t = std::unordered_map<const void *, TSiteCounters>;
+
+/// One acquisition of the lock, as written in the Chrome trace.
+struct TLockEvent {
+   const void *fSite;
+   Long64_t fRequested;
+   Long64_t fAcquired;
+   Long64_t fReleased;
+   UInt_t fThread;
+};
+
+/// A lock currently held by this thread.
+struct THeldLock {
+   const void *fSite;
+   Long64_t fRequested;
+   Long64_t fAcquired;
+};
+
+struct TThreadRecord;
+
+struct TRegistry {
+   std::mutex fMutex;                     ///< Protects all the members but fTraceEvents and fDroppedEvents
+   std::vector<TThreadRecord *> fThreads; ///< Records of the running threads
+   SiteMap_t fRetiredSites;               ///< Counters of the threads that exited
+   std::vector<TLockEvent> fRetiredEvents; ///< Events of the threads that exited
+   UInt_t fNextThread = 0;
+   std::atomic<bool> fTraceEvents{false};
+   std::atomic<ULong64_t> fDroppedEvents{0};
+};
+
+/// The registry is never deleted: threads might still exit after the static destructors ran.
+TRegistry &GetRegistry()
+{
+   static TRegistry *registry = new TRegistry;
+   return *registry;
+}
+
+struct TThreadRecord {
+   std::mutex fMutex;              ///< Protects fSites and fEvents against a concurrent report
+   SiteMap_t fSites;
+   std::vector<TLockEvent> fEvents;
+   std::vector<THeldLock> fHeld;   ///< Only used by the owning thread
+   UInt_t fThread;
+
+   TThreadRecord()
+   {
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      fThread = registry.fNextThread++;
+      registry.fThreads.push_back(this);
+   }
+
+   ~TThreadRecord()
+   {
+      auto &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      for (auto &site : fSites)
+         registry.fRetiredSites[site.first].Add(site.second);
+      registry.fRetiredEvents.insert(registry.fRetiredEvents.end(), fEvents.begin(), fEvents.end());
+      registry.fThreads.erase(std::find(registry.fThreads.begin(), registry.fThreads.end(), this));
+   }
+};
+
+TThreadRecord &GetThreadRecord()
+{
+   TTHREAD_TLS_DECL(TThreadRecord, record);
+   return record;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Name of the function containing `site`, followed by the library name.
+
+std::string ResolveCallSite(const void *site)
+{
+   if (!site)
+      return "<unknown>";
+   char address[32];
+   snprintf(address, sizeof(address), "%p", site);
+#ifndef _WIN32
+   Dl_info info;
+   if (dladdr(site, &info)) {
+      std::string name = address;
+      if (info.dli_sname) {
+         int status = 0;
+         char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+         name = (status == 0 && demangled) ? demangled : info.dli_sname;
+         free(demangled);
+      }
+      if (info.dli_fname) {
+         const char *lib = strrchr(info.dli_fname, '/');
+         name += " [";
+         name += lib ? lib + 1 : info.dli_fname;
+         name += "]";
+      }
+      return name;
+   }
+#endif
+   return address;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call `func` on the counters and events of all threads, alive or not, with
+/// the registry locked.
+
+template <typename F>
+void ForEachRecord(F &&func)
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   func(registry.fRetiredSites, registry.fRetiredEvents);
+   for (auto record : registry.fThreads) {
+      std::lock_guard<std::mutex> recordLock(record->fMutex);
+      func(record->fSites, record->fEvents);
+   }
+}
+
+/**
+ * \class TProfiledRWMutex
+ * Forwards to the instrumented TVirtualRWMutex, recording the call site and
+ * timing of each acquisition.
+ */
+class TProfiledRWMutex : public ROOT::TVirtualRWMutex {
+   ROOT::TVirtualRWMutex *fMutex; ///< The instrumented mutex
+
+   void Acquired(const void *site, Long64_t requested)
+   {
+      GetThreadRecord().fHeld.push_back({site, requested, Now()});
+   }
+
+   void Released(Long64_t released)
+   {
+      auto &record = GetThreadRecord();
+      // The lock was taken before the profiler was enabled
+      if (record.fHeld.empty())
+         return;
+      const auto held = record.fHeld.back();
+      record.fHeld.pop_back();
+
+      const auto wait = held.fAcquired - held.fRequested;
+      std::lock_guard<std::mutex> lock(record.fMutex);
+      auto &counters = record.fSites[held.fSite];
+      ++counters.fAcquisitions;
+      counters.fWait += wait;
+      counters.fMaxWait = std::max(counters.fMaxWait, wait);
+      counters.fHold += released - held.fAcquired;
+
+      auto &registry = GetRegistry();
+      if (registry.fTraceEvents) {
+         if (record.fEvents.size() < kMaxEventsPerThread)
+            record.fEvents.push_back({held.fSite, held.fRequested, held.fAcquired, released, record.fThread});
+         else
+            ++registry.fDroppedEvents;
+      }
+   }
+
+public:
+   TProfiledRWMutex(ROOT::TVirtualRWMutex *mutex) : fMutex(mutex) {}
+
+   ROOT::TVirtualRWMutex *GetMutex() const { return fMutex; }
+
+   // Lock() and TryLock() do not go through WriteLock() so that the return
+   // address is the one of the caller.
+   Int_t Lock() override
+   {
+      const auto site = R__LOCK_CALLSITE();
+      const auto requested = Now();
+      fMutex->WriteLock();
+      Acquired(site, requested);
+      return 1;
+   }
+   Int_t TryLock() override
+   {
+      const auto site = R__LOCK_CALLSITE();
+      const auto requested = Now();
+      fMutex->WriteLock();
+      Acquired(site, requested);
+      return 1;
+   }
+   Int_t UnLock() override
+   {
+      const auto released = Now();
+      fMutex->WriteUnLock(nullptr);
+      Released(released);
+      return 1;
+   }
+   Int_t CleanUp() override { return UnLock(); }
+
+   Hint_t *ReadLock() override
+   {
+      const auto site = R__LOCK_CALLSITE();
+      const auto requested = Now();
+      auto hint = fMutex->ReadLock();
+      Acquired(site, requested);
+      return hint;
+   }
+   void ReadUnLock(Hint_t *hint) override
+   {
+      const auto released = Now();
+      fMutex->ReadUnLock(hint);
+      Released(released);
+   }
+   Hint_t *WriteLock() override
+   {
+      const auto site = R__LOCK_CALLSITE();
+      const auto requested = Now();
+      auto hint = fMutex->WriteLock();
+      Acquired(site, requested);
+      return hint;
+   }
+   void WriteUnLock(Hint_t *hint) override
+   {
+      const auto released = Now();
+      fMutex->WriteUnLock(hint);
+      Released(released);
+   }
+
+   ROOT::TVirtualRWMutex *Factory(Bool_t recursive = kFALSE) override { return fMutex->Factory(recursive); }
+
+   // The time during which the lock is rewound is counted as held.
+   std::unique_ptr<State> GetStateBefore() override { return fMutex->GetStateBefore(); }
+   std::unique_ptr<StateDelta> Rewind(const State &earlierState) override { return fMutex->Rewind(earlierState); }
+   void Apply(std::unique_ptr<StateDelta> &&delta) override { fMutex->Apply(std::move(delta)); }
+};
+
+/// Created by the first Enable() and never deleted: a thread might still be
+/// using it after Disable().
+TProfiledRWMutex *gProfiledMutex = nullptr;
+
+} // unnamed namespace
+
+namespace ROOT {
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start recording the acquisitions of the global ROOT lock. Thread safety
+/// is enabled if needed (see ROOT::EnableThreadSafety()).
+/// \param[in] traceEvents Also record each acquisition, see WriteChromeTrace().
+
+void TLockProfiler::Enable(Bool_t traceEvents)
+{
+   GetRegistry().fTraceEvents = traceEvents;
+   if (IsEnabled())
+      return;
+
+   if (!ROOT::gCoreMutex)
+      ROOT::EnableThreadSafety();
+
+   auto mutex = ROOT::gCoreMutex;
+   if (!gProfiledMutex || gProfiledMutex->GetMutex() != mutex)
+      gProfiledMutex = new TProfiledRWMutex(mutex);
+
+   ROOT::gCoreMutex = gProfiledMutex;
+   if (gInterpreterMutex == mutex)
+      gInterpreterMutex = gProfiledMutex;
+   if (gROOTMutex == mutex)
+      gROOTMutex = gProfiledMutex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop recording; the counters collected so far are kept.
+
+void TLockProfiler::Disable()
+{
+   if (!IsEnabled())
+      return;
+
+   auto mutex = gProfiledMutex->GetMutex();
+   ROOT::gCoreMutex = mutex;
+   if (gInterpreterMutex == gProfiledMutex)
+      gInterpreterMutex = mutex;
+   if (gROOTMutex == gProfiledMutex)
+      gROOTMutex = mutex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the acquisitions of the global lock are being recorded.
+
+Bool_t TLockProfiler::IsEnabled()
+{
+   return gProfiledMutex && ROOT::gCoreMutex == gProfiledMutex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the counters and events collected so far.
+
+void TLockProfiler::Reset()
+{
+   ForEachRecord([](SiteMap_t &sites, std::vector<TLockEvent> &events) {
+      sites.clear();
+      events.clear();
+   });
+   GetRegistry().fDroppedEvents = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Counters of all the call sites, sorted by decreasing wait time. Call sites
+/// resolving to the same function are merged.
+
+std::vector<TLockProfiler::TCallSiteStats> TLockProfiler::GetStats()
+{
+   SiteMap_t sites;
+   ForEachRecord([&sites](SiteMap_t &recordSites, std::vector<TLockEvent> &) {
+      for (auto &site : recordSites)
+         sites[site.first].Add(site.second);
+   });
+
+   std::map<std::string, TSiteCounters> byName;
+   for (auto &site : sites)
+      byName[ResolveCallSite(site.first)].Add(site.second);
+
+   std::vector<TCallSiteStats> stats;
+   for (auto &site : byName) {
+      stats.emplace_back();
+      auto &s = stats.back();
+      s.fCallSite = site.first;
+      s.fAcquisitions = site.second.fAcquisitions;
+      s.fWaitTime = site.second.fWait * 1e-9;
+      s.fMaxWaitTime = site.second.fMaxWait * 1e-9;
+      s.fHoldTime = site.second.fHold * 1e-9;
+   }
+   std::sort(stats.begin(), stats.end(),
+             [](const TCallSiteStats &a, const TCallSiteStats &b) { return a.fWaitTime > b.fWaitTime; });
+   return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the counters of the `nsites` call sites that waited the most for the
+/// lock (all of them if `nsites` is 0).
+
+void TLockProfiler::Print(UInt_t nsites)
+{
+   auto stats = GetStats();
+   if (nsites && stats.size() > nsites)
+      stats.resize(nsites);
+
+   Printf("%12s %12s %14s %12s  %s", "Acquisitions", "Wait [ms]", "Max wait [ms]", "Hold [ms]", "Call site");
+   for (auto &s : stats) {
+      Printf("%12llu %12.3f %14.3f %12.3f  %s", s.fAcquisitions, s.fWaitTime * 1e3, s.fMaxWaitTime * 1e3,
+             s.fHoldTime * 1e3, s.fCallSite.c_str());
+   }
+   if (auto dropped = GetRegistry().fDroppedEvents.load())
+      Printf("%llu trace events were dropped", dropped);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the recorded acquisitions in the Chrome trace event format, one
+/// "lock wait" and one "lock hold" slice per acquisition. Events are only
+/// recorded if Enable() was called with `traceEvents` set.
+/// Return kFALSE if the file cannot be written.
+
+Bool_t TLockProfiler::WriteChromeTrace(const char *filename)
+{
+   std::vector<TLockEvent> events;
+   ForEachRecord([&events](SiteMap_t &, std::vector<TLockEvent> &recordEvents) {
+      events.insert(events.end(), recordEvents.begin(), recordEvents.end());
+   });
+
+   std::ofstream out(filename);
+   if (!out) {
+      Error("TLockProfiler::WriteChromeTrace", "cannot open %s", filename);
+      return kFALSE;
+   }
+
+   Long64_t origin = 0;
+   if (!events.empty()) {
+      origin = std::min_element(events.begin(), events.end(), [](const TLockEvent &a, const TLockEvent &b) {
+                  return a.fRequested < b.fRequested;
+               })->fRequested;
+   }
+
+   std::unordered_map<const void *, std::string> names;
+   auto writeSlice = [&out, origin](const std::string &name, const char *cat, UInt_t thread, Long64_t start,
+                                    Long64_t end, bool first) {
+      out << (first ? "\n" : ",\n") << "{\"name\":\"" << name << "\",\"cat\":\"" << cat
+          << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread << ",\"ts\":" << Form("%.3f", (start - origin) * 1e-3)
+          << ",\"dur\":" << Form("%.3f", (end - start) * 1e-3) << "}";
+   };
+
+   out << "{\"traceEvents\":[";
+   bool first = true;
+   for (auto &e : events) {
+      auto name = names.find(e.fSite);
+      if (name == names.end()) {
+         std::string resolved;
+         // escape for JSON
+         for (auto c : ResolveCallSite(e.fSite)) {
+            if (c == '"' || c == '\\')
+               resolved += '\\';
+            resolved += c;
+         }
+         name = names.emplace(e.fSite, resolved).first;
+      }
+      if (e.fAcquired > e.fRequested) {
+         writeSlice(name->second, "lock wait", e.fThread, e.fRequested, e.fAcquired, first);
+         first = false;
+      }
+      writeSlice(name->second, "lock hold", e.fThread, e.fAcquired, e.fReleased, first);
+      first = false;
+   }
+   out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+   if (!out) {
+      Error("TLockProfiler::WriteChromeTrace", "error while writing %s", filename);
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+} // namespace Experimental
+} // namespace ROOT
@@ -0,0 +1,53 @@
+#include "ROOT/TLockProfiler.hxx"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TVirtualRWMutex.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+void TakeLock(int n)
+{
+   for (int i = 0; i < n; ++i) {
+      R__LOCKGUARD(gROOTMutex);
+   }
+}
+
+TEST(TLockProfiler, Counts)
+{
+   TLockProfiler::Enable(kTRUE);
+   EXPECT_TRUE(TLockProfiler::IsEnabled());
+   TLockProfiler::Reset();
+
+   const int nThreads = 4;
+   const int nLocks = 1000;
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nThreads; ++i)
+      threads.emplace_back(TakeLock, nLocks);
+   for (auto &t : threads)
+      t.join();
+
+   TLockProfiler::Disable();
+   EXPECT_FALSE(TLockProfiler::IsEnabled());
+   // Not recorded anymore
+   TakeLock(nLocks);
+
+   ULong64_t acquisitions = 0;
+   for (auto &s : TLockProfiler::GetStats()) {
+      acquisitions += s.fAcquisitions;
+      EXPECT_GE(s.fWaitTime, s.fMaxWaitTime);
+   }
+   EXPECT_EQ(acquisitions, ULong64_t(nThreads * nLocks));
+
+   const char *filename = "testTLockProfiler.json";
+   EXPECT_TRUE(TLockProfiler::WriteChromeTrace(filename));
+   EXPECT_FALSE(gSystem->AccessPathName(filename));
+   gSystem->Unlink(filename);
+
+   TLockProfiler::Reset();
+   EXPECT_TRUE(TLockProfiler::GetStats().empty());
+}
@@ -25,8 +25,11 @@ namespace ROOT {
 ///    compression usually results in greater compression factors, but takes
 ///    more CPU time and memory when compressing. LZMA memory usage is particularly
 ///    high for compression levels 8 and 9.
-///  - Finally, the LZ4 package results in worse compression ratios
+///  - The LZ4 package results in worse compression ratios
 ///    than ZLIB but achieves much faster decompression rates.
+///  - Finally, the ZSTD algorithm (Zstandard) achieves compression ratios
+///    close to LZMA with decompression rates close to LZ4. It is only available
+///    if ROOT was built with the `zstd` option (R__HAS_ZSTD is defined).
 ///
 /// The current algorithms support level 1 to 9. The higher the level the greater
 /// the compression and more CPU time and memory resources used during compression.
@@ -42,6 +45,8 @@ enum ECompressionAlgorithm {
    kOldCompressionAlgo,
    /// Use LZ4 compression
    kLZ4,
+   /// Use ZSTD compression
+   kZSTD,
    /// Undefined compression algorithm (must be kept the last of the list in case a new algorithm is added).
    kUndefinedCompressionAlgorithm
 };
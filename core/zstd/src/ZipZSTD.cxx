@@ -0,0 +1,144 @@
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ZipZSTD.h"
+
+#include "ROOT/RConfig.h"
+#include "RConfigure.h"
+
+#include <cstdio>
+
+#ifdef R__HAS_ZSTD
+
+#include <memory>
+#include <zstd.h>
+
+// Header consists of:
+// - 2 byte identifier "ZS"
+// - 1 byte ZSTD major version.
+// - 3 bytes of compressed size
+// - 3 bytes of uncompressed size
+// The payload is a regular ZSTD frame; ZSTD adds its own content checksum.
+static const int kHeaderSize = 2 + 1 + 3 + 3;
+
+namespace {
+struct ZSTDCCtxDeleter {
+   void operator()(ZSTD_CCtx *ctx) const { ZSTD_freeCCtx(ctx); }
+};
+struct ZSTDDCtxDeleter {
+   void operator()(ZSTD_DCtx *ctx) const { ZSTD_freeDCtx(ctx); }
+};
+} // namespace
+
+// Baskets are small and numerous: keep one (de)compression context per thread
+// instead of allocating ZSTD's internal tables for every buffer.
+static ZSTD_CCtx *GetCompressionContext()
+{
+   thread_local std::unique_ptr<ZSTD_CCtx, ZSTDCCtxDeleter> ctx(ZSTD_createCCtx());
+   return ctx.get();
+}
+
+static ZSTD_DCtx *GetDecompressionContext()
+{
+   thread_local std::unique_ptr<ZSTD_DCtx, ZSTDDCtxDeleter> ctx(ZSTD_createDCtx());
+   return ctx.get();
+}
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+   *irep = 0;
+
+   if (R__unlikely(*tgtsize <= kHeaderSize)) {
+      return;
+   }
+
+   // Refuse to compress more than 16MB at a time -- we are only allowed 3 bytes for size info.
+   if (R__unlikely(*srcsize > 0xffffff || *srcsize < 0)) {
+      return;
+   }
+
+   ZSTD_CCtx *ctx = GetCompressionContext();
+   if (R__unlikely(!ctx)) {
+      return;
+   }
+
+   if (cxlevel > ZSTD_maxCLevel()) {
+      cxlevel = ZSTD_maxCLevel();
+   }
+   size_t returnStatus = ZSTD_compressCCtx(ctx, &tgt[kHeaderSize], *tgtsize - kHeaderSize, src, *srcsize, cxlevel);
+
+   // Also covers the case where the output does not fit in the target buffer.
+   if (R__unlikely(ZSTD_isError(returnStatus))) {
+      return;
+   }
+
+   tgt[0] = 'Z';
+   tgt[1] = 'S';
+   tgt[2] = ZSTD_VERSION_MAJOR;
+
+   unsigned out_size = (unsigned)returnStatus; /* compressed size */
+   unsigned in_size = (unsigned)(*srcsize);
+
+   // NOTE: these next 6 bytes are required from the ROOT compressed buffer format;
+   // upper layers will assume they are laid out in a specific manner.
+   tgt[3] = (char)(out_size & 0xff);
+   tgt[4] = (char)((out_size >> 8) & 0xff);
+   tgt[5] = (char)((out_size >> 16) & 0xff);
+
+   tgt[6] = (char)(in_size & 0xff); /* decompressed size */
+   tgt[7] = (char)((in_size >> 8) & 0xff);
+   tgt[8] = (char)((in_size >> 16) & 0xff);
+
+   *irep = (int)returnStatus + kHeaderSize;
+}
+
+void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
+{
+   // NOTE: We don't check that srcsize / tgtsize is reasonable or within the ROOT-imposed limits.
+   // This is assumed to be handled by the upper layers.
+
+   *irep = 0;
+   if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
+      fprintf(stderr, "R__unzipZSTD: algorithm run against buffer with incorrect header (got %d%d; expected %d%d).\n",
+              src[0], src[1], 'Z', 'S');
+      return;
+   }
+
+   ZSTD_DCtx *ctx = GetDecompressionContext();
+   if (R__unlikely(!ctx)) {
+      return;
+   }
+
+   size_t returnStatus = ZSTD_decompressDCtx(ctx, tgt, *tgtsize, &src[kHeaderSize], *srcsize - kHeaderSize);
+   if (R__unlikely(ZSTD_isError(returnStatus))) {
+      fprintf(stderr, "R__unzipZSTD: error in decompression: %s\n", ZSTD_getErrorName(returnStatus));
+      return;
+   }
+
+   *irep = (int)returnStatus;
+}
+
+#else
+
+// ROOT was built without ZSTD: buffers are left uncompressed when writing, and
+// reading a ZSTD-compressed buffer fails with an explicit message.
+
+void R__zipZSTD(int /* cxlevel */, int * /* srcsize */, char * /* src */, int * /* tgtsize */, char * /* tgt */,
+                int *irep)
+{
+   *irep = 0;
+}
+
+void R__unzipZSTD(int * /* srcsize */, unsigned char * /* src */, int * /* tgtsize */, unsigned char * /* tgt */,
+                  int *irep)
+{
+   *irep = 0;
+   fprintf(stderr, "R__unzipZSTD: ROOT was built without ZSTD support; cannot decompress this buffer.\n");
+}
+
+#endif
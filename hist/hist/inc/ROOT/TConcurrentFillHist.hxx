@@ -0,0 +1,244 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TConcurrentFillHist
+#define ROOT_TConcurrentFillHist
+
+#include "TH1.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+
+namespace TConcurrentFillHistUtils {
+
+/// Get a unique identifier for a TConcurrentFillHist instance.
+inline ULong64_t GetTConcurrentFillHistID()
+{
+   static std::atomic<ULong64_t> fgTConcurrentFillHistID(0);
+   return ++fgTConcurrentFillHistID;
+}
+
+/// Call h.Fill(args...); the overload below is selected for the argument
+/// counts that HIST::Fill() does not accept, which are never buffered.
+template <class HIST, class... ARGS>
+auto CallFill(HIST &h, ARGS... args) -> decltype(h.Fill(args...), void())
+{
+   h.Fill(args...);
+}
+
+template <class HIST>
+void CallFill(HIST &, ...)
+{
+}
+
+} // End of namespace TConcurrentFillHistUtils
+} // End of namespace Internal
+
+/**
+ * \class ROOT::TConcurrentFillHist
+ * \brief A wrapper to fill one histogram from several threads concurrently.
+ * \tparam HIST Class of the histogram (e.g. TH1D, TH3F or TProfile)
+ * \ingroup Hist
+ *
+ * The calls to Fill() are recorded in a small buffer per thread (or per
+ * processing slot). When a buffer is full, it is replayed into the
+ * histogram, with a lock held. Compared to ROOT::TThreadedObject, which
+ * clones the whole histogram for each thread and merges the clones at the
+ * end, the memory does not grow with the number of threads beyond the size
+ * of the buffers, which makes it suited for histograms with many bins.
+ *
+ * The histogram is brought up to date lazily, by Flush(), which is called by
+ * Get() and the arrow operator: once all threads are done filling, the
+ * histogram can be read directly.
+ * ~~~{.cpp}
+ * ROOT::TConcurrentFillHist<TH3D> h(std::make_shared<TH3D>("h", "h", 100, 0, 1, 100, 0, 1, 100, 0, 1));
+ * ROOT::TTreeProcessorMT tp("file.root", "tree");
+ * tp.Process([&h](TTreeReader &r) {
+ *    TTreeReaderValue<double> x(r, "x"), y(r, "y"), z(r, "z");
+ *    while (r.Next())
+ *       h.Fill(*x, *y, *z);
+ * });
+ * h->Draw();
+ * ~~~
+ * In case the threads are identified by "processing slots", as in
+ * TDataFrame, FillAtSlot() avoids the lookup of the slot of the thread.
+ */
+template <class HIST>
+class TConcurrentFillHist {
+public:
+   static unsigned fgMaxSlots;   ///< The default maximum number of processing slots (distinct threads)
+   static unsigned fgBufferSize; ///< The number of values buffered per slot before they are filled
+
+   TConcurrentFillHist(const TConcurrentFillHist &) = delete;
+   TConcurrentFillHist &operator=(const TConcurrentFillHist &) = delete;
+
+   /// Fill the histogram hist, from at most nSlots distinct threads (further
+   /// threads fill the histogram directly, with the lock held).
+   TConcurrentFillHist(const std::shared_ptr<HIST> &hist, unsigned nSlots = fgMaxSlots)
+      : fHist(hist), fSlots(nSlots), fID(Internal::TConcurrentFillHistUtils::GetTConcurrentFillHistID())
+   {
+      static_assert(std::is_base_of<TH1, HIST>::value, "TConcurrentFillHist only supports histograms");
+   }
+
+   ~TConcurrentFillHist() { Flush(); }
+
+   /// Thread-safe HIST::Fill(): can be called from any thread.
+   template <class... ARGS>
+   void Fill(ARGS... args)
+   {
+      FillAtSlot(GetThisSlotNumber(), args...);
+   }
+
+   /// HIST::Fill() for the processing slot slot. This method is
+   /// *thread-unsafe*: it cannot be invoked from two different threads with
+   /// the same slot at the same time.
+   template <class... ARGS>
+   void FillAtSlot(unsigned slot, ARGS... args)
+   {
+      static_assert(sizeof...(ARGS) > 0 && sizeof...(ARGS) <= 4, "Fill() takes between one and four arguments");
+      static_assert(std::is_same<decltype(std::declval<HIST &>().Fill(static_cast<Double_t>(args)...)), Int_t>::value,
+                    "HIST::Fill() cannot be called with these arguments");
+      if (slot >= fSlots.size()) {
+         std::lock_guard<std::mutex> lock(fHistMutex);
+         fHist->Fill(static_cast<Double_t>(args)...);
+         return;
+      }
+      auto &buffer = fSlots[slot].fBuffer;
+      // each fill is stored as the number of arguments followed by the arguments
+      buffer.insert(buffer.end(), {static_cast<Double_t>(sizeof...(ARGS)), static_cast<Double_t>(args)...});
+      if (buffer.size() >= fgBufferSize)
+         FlushSlot(slot);
+   }
+
+   /// Fill the buffered values of slot into the histogram. Thread-safe, as
+   /// long as no other thread fills the same slot.
+   void FlushSlot(unsigned slot)
+   {
+      if (slot >= fSlots.size())
+         return;
+      auto &buffer = fSlots[slot].fBuffer;
+      if (buffer.empty())
+         return;
+      {
+         std::lock_guard<std::mutex> lock(fHistMutex);
+         for (auto value = buffer.begin(); value != buffer.end();) {
+            const auto nargs = static_cast<unsigned>(*value++);
+            Replay(nargs, &*value);
+            value += nargs;
+         }
+      }
+      buffer.clear();
+   }
+
+   /// Fill the buffered values of all slots into the histogram. This method
+   /// is *thread-unsafe*: no thread can fill at the same time.
+   void Flush()
+   {
+      for (unsigned slot = 0; slot < fSlots.size(); ++slot)
+         FlushSlot(slot);
+   }
+
+   /// Return a copy of the histogram with the values filled so far, without
+   /// those still buffered by the slots other than slot (all of them if
+   /// slot is not a valid slot). Thread-safe, as long as no other thread
+   /// fills the same slot.
+   std::unique_ptr<HIST> Snapshot(unsigned slot = -1)
+   {
+      FlushSlot(slot);
+      std::lock_guard<std::mutex> lock(fHistMutex);
+      std::unique_ptr<HIST> snapshot(new HIST(*fHist));
+      snapshot->SetDirectory(nullptr);
+      return snapshot;
+   }
+
+   /// Access the histogram after filling all buffered values. This method is
+   /// *thread-unsafe*: no thread can fill at the same time.
+   std::shared_ptr<HIST> Get()
+   {
+      Flush();
+      return fHist;
+   }
+
+   /// Access the histogram, after filling all buffered values, and allow to
+   /// call its methods. This method is *thread-unsafe*: no thread can fill at
+   /// the same time.
+   HIST *operator->() { return Get().get(); }
+
+private:
+   /// The buffer of a slot, padded to occupy its own cache line.
+   struct TSlot {
+      std::vector<Double_t> fBuffer;
+      char fPadding[64 - sizeof(std::vector<Double_t>) % 64];
+   };
+
+   std::shared_ptr<HIST> fHist;                       ///< The histogram that is filled
+   std::vector<TSlot> fSlots;                         ///< The buffered fills of each slot
+   std::mutex fHistMutex;                             ///< Mutex protecting the histogram
+   const ULong64_t fID;                               ///< Unique identifier of the instance
+   std::map<std::thread::id, unsigned> fThrIDSlotMap; ///< A mapping between the thread IDs and the slots
+   std::mutex fThrIDSlotMutex;                        ///< Mutex to protect the ID-slot map access
+
+   /// Call fHist->Fill() with the nargs arguments args.
+   void Replay(unsigned nargs, const Double_t *args)
+   {
+      using Internal::TConcurrentFillHistUtils::CallFill;
+      switch (nargs) {
+      case 1: CallFill(*fHist, args[0]); break;
+      case 2: CallFill(*fHist, args[0], args[1]); break;
+      case 3: CallFill(*fHist, args[0], args[1], args[2]); break;
+      case 4: CallFill(*fHist, args[0], args[1], args[2], args[3]); break;
+      }
+   }
+
+   /// Get the slot number for this thread. The slot of the instance that the
+   /// thread filled last is cached, to avoid a lookup in the map for each fill.
+   unsigned GetThisSlotNumber()
+   {
+      thread_local ULong64_t tlsLastID = 0;
+      thread_local unsigned tlsLastSlot = 0;
+      if (tlsLastID == fID)
+         return tlsLastSlot;
+
+      const auto thisThreadID = std::this_thread::get_id();
+      unsigned thisIndex;
+      {
+         std::lock_guard<std::mutex> lg(fThrIDSlotMutex);
+         auto thisSlotNumIt = fThrIDSlotMap.find(thisThreadID);
+         if (thisSlotNumIt != fThrIDSlotMap.end()) {
+            thisIndex = thisSlotNumIt->second;
+         } else {
+            thisIndex = fThrIDSlotMap.size();
+            fThrIDSlotMap[thisThreadID] = thisIndex;
+         }
+      }
+      tlsLastID = fID;
+      tlsLastSlot = thisIndex;
+      return thisIndex;
+   }
+};
+
+template <class HIST>
+unsigned TConcurrentFillHist<HIST>::fgMaxSlots = 64;
+template <class HIST>
+unsigned TConcurrentFillHist<HIST>::fgBufferSize = 1024;
+
+} // End ROOT namespace
+
+#endif
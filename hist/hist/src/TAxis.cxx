@@ -420,6 +420,57 @@ Int_t TAxis::FindFixBin(Double_t x) const
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers of the n abscissas x[0], x[stride], ..., x[(n-1)*stride]
+/// and store them in bins[0], ..., bins[n-1].
+///
+/// The bins are the same as those returned by TAxis::FindFixBin for each
+/// abscissa, but they are computed without branches: for fix bins, the
+/// loop over the abscissas can be vectorized by the compiler; for variable
+/// bins, the binary search does not depend on branch predictions.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t *bins, Int_t stride) const
+{
+   const Double_t xmin = fXmin;
+   const Double_t xmax = fXmax;
+   const Int_t nbins = fNbins;
+   if (!fXbins.fN) {        //*-* fix bins
+      const Double_t width = xmax - xmin;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[(Long64_t)i*stride];
+         // move the underflows, overflows and NaNs in range before the conversion to int
+         const Double_t xin = (xi >= xmin && xi < xmax) ? xi : xmin;
+         const Int_t bin = 1 + int (nbins*(xin-xmin)/width);
+         bins[i] = (xi < xmin) ? 0 : ((xi < xmax) ? bin : nbins+1);
+      }
+   } else {                  //*-* variable bin sizes
+      const Double_t *edges = fXbins.fArray;
+      const Int_t nedges = fXbins.fN;
+      for (Int_t i = 0; i < n; ++i) {
+         const Double_t xi = x[(Long64_t)i*stride];
+         if (xi < xmin) {
+            bins[i] = 0;
+            continue;
+         }
+         if (!(xi < xmax)) {
+            bins[i] = nbins+1;
+            continue;
+         }
+         // lower bound of xi in the edges, halving the range without branches
+         const Double_t *base = edges;
+         Int_t len = nedges;
+         while (len > 1) {
+            const Int_t half = len / 2;
+            base = (base[half] < xi) ? base + half : base;
+            len -= half;
+         }
+         const Int_t lower = (base - edges) + (*base < xi);
+         // same as TMath::BinarySearch: index of the edge equal to xi, or of the last one below
+         bins[i] = 1 + ((edges[lower] == xi) ? lower : lower - 1);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
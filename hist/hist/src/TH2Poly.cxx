@@ -17,6 +17,8 @@
 #include "TList.h"
 #include "TMath.h"
 
+#include <vector>
+
 ClassImp(TH2Poly);
 
 /** \class TH2Poly
@@ -56,19 +58,15 @@ histogram limits is added. This is done when the default constructor (with no
 arguments) is used. It generates a histogram with no limits along the X and Y
 axis. Adding bins to it will extend it up to a proper size.
 
-`TH2Poly` implements a partitioning algorithm to speed up bins' filling.
-The partitioning algorithm divides the histogram into regions called cells.
-The bins that each cell intersects are recorded in an array of `TList`s.
-When a coordinate in the histogram is to be filled; the method (quickly) finds
-which cell the coordinate belongs.  It then only loops over the bins
-intersecting that cell to find the bin the input coordinate corresponds to.
-The partitioning of the histogram is updated continuously as each bin is added.
-The default number of cells on each axis is 25. This number could be set to
-another value in the constructor or adjusted later by calling the
-`ChangePartition(Int_t, Int_t)` method. The partitioning algorithm is
-considerably faster than the brute force algorithm (i.e. checking if each bin
-contains the input coordinates), especially if the histogram is to be filled
-many times.
+`TH2Poly` implements a quadtree index to speed up bins' filling.
+The quadtree divides the area covered by the bins into rectangular nodes,
+each split in four quadrants as long as it overlaps many bins. When a
+coordinate in the histogram is to be filled, the method (quickly) finds
+which leaf of the quadtree the coordinate belongs to. It then only loops
+over the bins overlapping that leaf to find the bin the input coordinate
+corresponds to. The quadtree is built at the first `Fill()` after bins
+have been added, and adapts to the size of the bins: the number of bins
+tested per fill stays small with many bins of very different sizes. See the section "Partitioning Algorithm" below.
 
 The following very simple macro shows how to build and fill a `TH2Poly`:
 ~~~ {.cpp}
@@ -107,35 +105,165 @@ This method checks if the input location is in that bin. If the filling
 coordinate is inside, the bin is filled. Looping over all the bin is
 very slow.
 
-The alternative is to divide the histogram into virtual rectangular regions
-called "cells". Each cell stores the pointers of the bins intersecting it.
-When a coordinate is to be filled, the method finds which cell the coordinate
-falls into. Since the cells are rectangular, this can be done very quickly.
-It then only loops over the bins associated with that cell.
-
-The addition of bins to the appropriate cells is done when the bin is added
-to the histogram. To do this, `AddBin()` calls the
-`AddBinToPartition()` method.
-This method adds the input bin to the partitioning matrix.
-
+The alternative is to divide the histogram into virtual rectangular regions.
+`Fill()` and `FindBin()` use a quadtree: its root covers the histogram
+limits (and the bins outside of them), and each node overlapping more than
+8 bounding boxes of bins is divided in four quadrants, unless this would
+mostly duplicate the bins in the quadrants. Each leaf of the quadtree
+stores the numbers of the bins whose bounding box overlaps it, in increasing
+order. When a coordinate is to be filled, the method descends the quadtree
+to the leaf containing it, and loops over the bins of the leaf, testing
+first their bounding box and then the polygon. If bins overlap, the one with
+the smallest number is filled, as with the brute force approach.
+
+The quadtree is built when it is first needed, and deleted when a bin is
+added or the partition is changed; adding bins is thus not slowed down by
+the quadtree. It also provides the access to the bins by number, e.g. for
+`GetBinContent()`, `SetBinContent()` and `Merge()`.
+
+The histogram is also divided into a fixed grid of cells, each storing
+the bins intersecting it, which is used by `TProfile2Poly::Fill()`.
 The number of partition cells per axis can be specified in the constructor.
 If it is not specified, the default value of 25 along each axis will be
-assigned. This value was chosen because it is small enough to avoid slowing
-down AddBin(), while being large enough to enhance Fill() by a considerable
-amount. Regardless of how it is initialized at construction time, it can be
+assigned. Regardless of how it is initialized at construction time, it can be
 changed later with the `ChangePartition()` method.
 `ChangePartition()` deletes the
 old partition matrix and generates a new one with the specified number of cells
 on each axis.
+*/
 
-The optimum number of partition cells per axis changes with the number of
-times `Fill()` will be called.  Although partitioning greatly speeds up
-filling, it also adds a constant time delay into the code. When `Fill()`
-is to be called many times, it is more efficient to divide the histogram into
-a large number cells. However, if the histogram is to be filled only a few
-times, it is better to divide into a small number of cells.
+/** \class TH2PolyQuadTree
+TH2PolyQuadTree is a class used by TH2Poly internally. It is an adaptive
+quadtree over the bounding boxes of the bins: a node is split in four
+quadrants as long as it overlaps more than kMaxLeafBins bins and the split
+spreads them over the quadrants. Each leaf lists, by increasing bin number,
+the bins whose bounding box overlaps it, so that FindBin() returns the same
+bin as a search through all the bins in order. The quadtree also gives a
+direct access to the bins by their number.
 */
 
+class TH2PolyQuadTree {
+public:
+   TH2PolyQuadTree(TList *bins, Double_t xmin, Double_t xmax, Double_t ymin, Double_t ymax);
+
+   /// Return the bin of number bin (starting at 1).
+   TH2PolyBin *GetBin(Int_t bin) const { return fBins[bin - 1]; }
+   TH2PolyBin *FindBin(Double_t x, Double_t y) const;
+
+private:
+   enum {
+      kMaxLeafBins = 8, // the nodes overlapping more bins are split
+      kMaxDepth    = 16 // maximum depth of the leaves
+   };
+
+   struct Box_t {
+      Double_t fXmin, fXmax, fYmin, fYmax;
+      Bool_t Overlaps(const Box_t &box) const {
+         return fXmin <= box.fXmax && fXmax >= box.fXmin && fYmin <= box.fYmax && fYmax >= box.fYmin;
+      }
+   };
+
+   struct Node_t {
+      Double_t fXmid, fYmid; // center of the node, where its quadrants meet
+      Int_t    fChild;       // index of the first of the four quadrants, -1 for a leaf
+      Int_t    fFirst;       // first bin of a leaf in fLeafBins
+      Int_t    fLast;        // one past the last bin of a leaf in fLeafBins
+   };
+
+   void Build(Int_t node, const Box_t &box, std::vector<Int_t> &bins, Int_t depth);
+
+   std::vector<TH2PolyBin*> fBins;     // the bins, by number - 1
+   std::vector<Box_t>       fBoxes;    // bounding box of the bins, by number - 1
+   std::vector<Node_t>      fNodes;    // the nodes, the root first and the four quadrants of a node next to each other
+   std::vector<Int_t>       fLeafBins; // the bins (number - 1) overlapping each leaf
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the quadtree of the bins in the list bins. Its root covers the
+/// rectangle (xmin, xmax, ymin, ymax), extended to the bins outside of it.
+
+TH2PolyQuadTree::TH2PolyQuadTree(TList *bins, Double_t xmin, Double_t xmax, Double_t ymin, Double_t ymax)
+{
+   Box_t root = {xmin, xmax, ymin, ymax};
+   TIter next(bins);
+   TH2PolyBin *bin;
+   while ((bin = (TH2PolyBin*) next())) {
+      Box_t box = {bin->GetXMin(), bin->GetXMax(), bin->GetYMin(), bin->GetYMax()};
+      root.fXmin = TMath::Min(root.fXmin, box.fXmin);
+      root.fXmax = TMath::Max(root.fXmax, box.fXmax);
+      root.fYmin = TMath::Min(root.fYmin, box.fYmin);
+      root.fYmax = TMath::Max(root.fYmax, box.fYmax);
+      fBins.push_back(bin);
+      fBoxes.push_back(box);
+   }
+
+   std::vector<Int_t> all(fBins.size());
+   for (UInt_t i = 0; i < all.size(); ++i) all[i] = i;
+   fNodes.resize(1);
+   Build(0, root, all, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make node, covering box, a leaf with the bins bins, or split it in four
+/// quadrants. The vector bins is emptied.
+
+void TH2PolyQuadTree::Build(Int_t node, const Box_t &box, std::vector<Int_t> &bins, Int_t depth)
+{
+   const Double_t xmid = 0.5*(box.fXmin + box.fXmax);
+   const Double_t ymid = 0.5*(box.fYmin + box.fYmax);
+   fNodes[node].fXmid = xmid;
+   fNodes[node].fYmid = ymid;
+
+   if (bins.size() > kMaxLeafBins && depth < kMaxDepth) {
+      // the quadrants, in the order of the index computed by FindBin()
+      const Box_t quadrants[4] = {{box.fXmin, xmid, box.fYmin, ymid}, {xmid, box.fXmax, box.fYmin, ymid},
+                                  {box.fXmin, xmid, ymid, box.fYmax}, {xmid, box.fXmax, ymid, box.fYmax}};
+      std::vector<Int_t> quadrantBins[4];
+      UInt_t nQuadrantBins = 0;
+      for (Int_t q = 0; q < 4; ++q) {
+         for (UInt_t i = 0; i < bins.size(); ++i) {
+            if (fBoxes[bins[i]].Overlaps(quadrants[q])) quadrantBins[q].push_back(bins[i]);
+         }
+         nQuadrantBins += quadrantBins[q].size();
+      }
+      // do not split if most bins overlap several quadrants: it would only
+      // duplicate them
+      if (nQuadrantBins <= 2*bins.size()) {
+         std::vector<Int_t>().swap(bins);
+         const Int_t child = fNodes.size();
+         fNodes[node].fChild = child;
+         fNodes.resize(child + 4);
+         for (Int_t q = 0; q < 4; ++q) Build(child + q, quadrants[q], quadrantBins[q], depth + 1);
+         return;
+      }
+   }
+
+   fNodes[node].fChild = -1;
+   fNodes[node].fFirst = fLeafBins.size();
+   fLeafBins.insert(fLeafBins.end(), bins.begin(), bins.end());
+   fNodes[node].fLast = fLeafBins.size();
+   std::vector<Int_t>().swap(bins);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the bin with the smallest number that contains (x,y), 0 if none.
+
+TH2PolyBin *TH2PolyQuadTree::FindBin(Double_t x, Double_t y) const
+{
+   Int_t node = 0;
+   while (fNodes[node].fChild >= 0) {
+      const Node_t &n = fNodes[node];
+      node = n.fChild + (x >= n.fXmid) + 2*(y >= n.fYmid);
+   }
+   for (Int_t i = fNodes[node].fFirst; i < fNodes[node].fLast; ++i) {
+      const Int_t bin = fLeafBins[i];
+      const Box_t &box = fBoxes[bin];
+      if (x < box.fXmin || x > box.fXmax || y < box.fYmin || y > box.fYmax) continue;
+      if (fBins[bin]->IsInside(x, y)) return fBins[bin];
+   }
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor. No boundaries specified.
 
@@ -181,6 +309,7 @@ TH2Poly::~TH2Poly()
    delete[] fCells;
    delete[] fIsEmpty;
    delete[] fCompletelyInside;
+   delete fQuadTree;
    // delete at the end the bin List since it owns the objects
    delete fBins;
 }
@@ -246,6 +375,10 @@ Int_t TH2Poly::AddBin(TObject *poly)
    fBins->Add((TObject*) bin);
    SetNewBinAdded(kTRUE);
 
+   // The quadtree is built again, with the new bin, when needed
+   delete fQuadTree;
+   fQuadTree = 0;
+
    // Adds the bin to the partition matrix
    AddBinToPartition(bin);
 
@@ -293,11 +426,12 @@ Bool_t TH2Poly::Add(const TH1 *h1, Double_t c1)
    }
 
    // Check if the bins are the same.
-   TList *h1pBins = h1p->GetBins();
+   TH2PolyQuadTree *thisBins = GetQuadTree();
+   TH2PolyQuadTree *h1pBins  = h1p->GetQuadTree();
    TH2PolyBin *thisBin, *h1pBin;
    for (bin = 1; bin <= GetNumberOfBins(); bin++) {
-      thisBin = (TH2PolyBin *)fBins->At(bin - 1);
-      h1pBin  = (TH2PolyBin *)h1pBins->At(bin - 1);
+      thisBin = thisBins->GetBin(bin);
+      h1pBin  = h1pBins->GetBin(bin);
       if (thisBin->GetXMin() != h1pBin->GetXMin() ||
             thisBin->GetXMax() != h1pBin->GetXMax() ||
             thisBin->GetYMin() != h1pBin->GetYMin() ||
@@ -328,7 +462,7 @@ Bool_t TH2Poly::Add(const TH1 *h1, Double_t c1)
    if (h1p->GetNormFactor() != 0)
       factor = h1p->GetNormFactor() / h1p->GetSumOfWeights();
    for (bin = 0; bin < fNcells; bin++) {
-      Double_t y = h1p->RetrieveBinContent(bin) + c1 * h1p->RetrieveBinContent(bin);
+      Double_t y = RetrieveBinContent(bin) + c1 * h1p->RetrieveBinContent(bin);
       UpdateBinContent(bin, y);
       if (fSumw2.fN) {
          Double_t esq = factor * factor * h1p->GetBinErrorSqUnchecked(bin);
@@ -487,6 +621,10 @@ void TH2Poly::ChangePartition(Int_t n, Int_t m)
    while((obj = next())){   // Loop over bins and add them to the partition
       AddBinToPartition((TH2PolyBin*) obj);
    }
+
+   // The histogram limits may have changed
+   delete fQuadTree;
+   fQuadTree = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -571,28 +709,9 @@ Int_t TH2Poly::FindBin(Double_t x, Double_t y, Double_t)
    else if (x > fXaxis.GetXmin()) overflow += -1;
    if (overflow != -5) return overflow;
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) return -5;
-
-   TH2PolyBin *bin;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   // Search for the bin in the cell
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      if (bin->IsInside(x,y)) return bin->GetBinNumber();
-   }
+   // Search for the bin in the quadtree leaf (x,y) belongs to
+   TH2PolyBin *bin = GetQuadTree()->FindBin(x, y);
+   if (bin) return bin->GetBinNumber();
 
    // If the search has not returned a bin, the point must be on "the sea"
    return -5;
@@ -626,53 +745,31 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
       return overflow;
    }
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
+   // Search for the bin in the quadtree leaf (x,y) belongs to
+   TH2PolyBin *bin = GetQuadTree()->FindBin(x, y);
 
-   if (fIsEmpty[n+fCellX*m]) {
+   if (!bin) {
       fOverflow[4]+= w;
       if (fSumw2.fN) fSumw2.fArray[4] += w*w;
       return -5;
    }
 
-   TH2PolyBin *bin;
-   Int_t bi;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      // needs to account offset in array for overflow bins
-      bi = bin->GetBinNumber()-1+kNOverflow;
-      if (bin->IsInside(x,y)) {
-         bin->Fill(w);
-
-         // Statistics
-         fTsumw   = fTsumw + w;
-         fTsumwx  = fTsumwx + w*x;
-         fTsumwx2 = fTsumwx2 + w*x*x;
-         fTsumwy  = fTsumwy + w*y;
-         fTsumwy2 = fTsumwy2 + w*y*y;
-         if (fSumw2.fN) fSumw2.fArray[bi] += w*w;
-         fEntries++;
+   // needs to account offset in array for overflow bins
+   Int_t bi = bin->GetBinNumber()-1+kNOverflow;
+   bin->Fill(w);
 
-         SetBinContentChanged(kTRUE);
+   // Statistics
+   fTsumw   = fTsumw + w;
+   fTsumwx  = fTsumwx + w*x;
+   fTsumwx2 = fTsumwx2 + w*x*x;
+   fTsumwy  = fTsumwy + w*y;
+   fTsumwy2 = fTsumwy2 + w*y*y;
+   if (fSumw2.fN) fSumw2.fArray[bi] += w*w;
+   fEntries++;
 
-         return bin->GetBinNumber();
-      }
-   }
+   SetBinContentChanged(kTRUE);
 
-   fOverflow[4]+= w;
-   if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-   return -5;
+   return bin->GetBinNumber();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -763,7 +860,7 @@ Double_t TH2Poly::GetBinContent(Int_t bin) const
 {
    if (bin > GetNumberOfBins() || bin == 0 || bin < -kNOverflow) return 0;
    if (bin<0) return fOverflow[-bin - 1];
-   return ((TH2PolyBin*) fBins->At(bin-1))->GetContent();
+   return GetPolyBin(bin)->GetContent();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -792,7 +889,7 @@ const char *TH2Poly::GetBinName(Int_t bin) const
 {
    if (bin > GetNumberOfBins())  return "";
    if (bin < 0)          return "";
-   return ((TH2PolyBin*) fBins->At(bin-1))->GetPolygon()->GetName();
+   return GetPolyBin(bin)->GetPolygon()->GetName();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -802,7 +899,7 @@ const char *TH2Poly::GetBinTitle(Int_t bin) const
 {
    if (bin > GetNumberOfBins())  return "";
    if (bin < 0)          return "";
-   return ((TH2PolyBin*) fBins->At(bin-1))->GetPolygon()->GetTitle();
+   return GetPolyBin(bin)->GetPolygon()->GetTitle();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -960,6 +1057,7 @@ void TH2Poly::Initialize(Double_t xlow, Double_t xup,
 
    fBins   = 0;
    fNcells = kNOverflow;
+   fQuadTree = 0;
 
    // Sets the boundaries of the histogram
    fXaxis.Set(100, xlow, xup);
@@ -1249,7 +1347,7 @@ void TH2Poly::SetBinContent(Int_t bin, Double_t content)
 {
    if (bin > GetNumberOfBins() || bin == 0 || bin < -9 ) return;
    if (bin > 0) {
-      ((TH2PolyBin*) fBins->At(bin-1))->SetContent(content);
+      GetPolyBin(bin)->SetContent(content);
    }
    else
       fOverflow[-bin - 1] = content;
@@ -1276,6 +1374,28 @@ Bool_t TH2Poly::IsInsideBin(Int_t binnr, Double_t x, Double_t y)
    return bin->IsInside(x,y);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the bin of number bin (starting at 1), which must be valid.
+/// The quadtree is used if it has been built, the list of bins otherwise.
+
+TH2PolyBin *TH2Poly::GetPolyBin(Int_t bin) const
+{
+   if (fQuadTree) return fQuadTree->GetBin(bin);
+   return (TH2PolyBin*) fBins->At(bin-1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the quadtree index of the bins, used by Fill(), FindBin() and
+/// for the access to the bins by number. It is built at the first call
+/// after a bin has been added or the partition has changed.
+
+TH2PolyQuadTree *TH2Poly::GetQuadTree()
+{
+   if (!fQuadTree)
+      fQuadTree = new TH2PolyQuadTree(fBins, fXaxis.GetXmin(), fXaxis.GetXmax(), fYaxis.GetXmin(), fYaxis.GetXmax());
+   return fQuadTree;
+}
+
 void TH2Poly::GetStats(Double_t *stats) const
 {
    stats[0] = fTsumw;
@@ -17,6 +17,8 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -271,9 +273,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin index.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -319,9 +321,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin index.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -410,6 +412,97 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinIndex
+THnSparseBinIndex is a class used by THnSparse internally. It maps the
+hashes of the compact bin coordinates of the filled bins to the bins' linear
+indexes. It is an open-addressing hash table with linear probing: each slot
+holds a hash and the corresponding linear index, next to each other, such
+that a lookup usually touches a single cache line. The capacity is a power
+of two; the table is grown when it is two thirds full. The slot of a hash is
+derived from a mix of all its bits, as the hash of small compact
+coordinates is the coordinate buffer itself.
+*/
+
+class THnSparseBinIndex {
+public:
+   THnSparseBinIndex(): fSize(0), fMask(0) {}
+
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fSlots.size(); }
+
+   /// Return the first slot to probe for hash.
+   Long64_t GetFirstSlot(ULong64_t hash) const { return Mix(hash) & fMask; }
+   /// Return the slot to probe after slot.
+   Long64_t GetNextSlot(Long64_t slot) const { return (slot + 1) & fMask; }
+   /// Return the linear index stored in slot, -1 if the slot is empty.
+   Long64_t GetIndex(Long64_t slot) const { return fSlots[slot].fIndex; }
+   /// Return the hash stored in slot.
+   ULong64_t GetHash(Long64_t slot) const { return fSlots[slot].fHash; }
+
+   void Reserve(Long64_t nbins);
+   void Add(ULong64_t hash, Long64_t linidx);
+
+private:
+   /// Finalization step of MurmurHash3, mixing all bits of hash.
+   static ULong64_t Mix(ULong64_t hash) {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ULL;
+      hash ^= hash >> 33;
+      return hash;
+   }
+
+   struct Slot_t {
+      ULong64_t fHash;  // hash of the bin's compact coordinates
+      Long64_t  fIndex; // linear index of the bin, -1 for an empty slot
+   };
+
+   std::vector<Slot_t> fSlots; // the slots, a power of two of them
+   Long64_t fSize;             // number of filled slots
+   Long64_t fMask;             // number of slots minus one
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure that nbins entries can be stored without growing the table.
+
+void THnSparseBinIndex::Reserve(Long64_t nbins)
+{
+   Long64_t capacity = GetCapacity() ? GetCapacity() : 16;
+   while (3 * nbins > 2 * capacity)
+      capacity *= 2;
+   if (capacity == GetCapacity())
+      return;
+
+   std::vector<Slot_t> oldSlots(capacity, Slot_t{0, -1});
+   oldSlots.swap(fSlots);
+   fMask = capacity - 1;
+   for (std::vector<Slot_t>::const_iterator iSlot = oldSlots.begin(); iSlot != oldSlots.end(); ++iSlot) {
+      if (iSlot->fIndex < 0) continue;
+      Long64_t slot = GetFirstSlot(iSlot->fHash);
+      while (fSlots[slot].fIndex >= 0)
+         slot = GetNextSlot(slot);
+      fSlots[slot] = *iSlot;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin with linear index linidx and hash. Bins with the same hash are
+/// stored in subsequent slots of the probe sequence.
+
+void THnSparseBinIndex::Add(ULong64_t hash, Long64_t linidx)
+{
+   Reserve(fSize + 1);
+   Long64_t slot = GetFirstSlot(hash);
+   while (fSlots[slot].fIndex >= 0)
+      slot = GetNextSlot(slot);
+   fSlots[slot].fHash = hash;
+   fSlots[slot].fIndex = linidx;
+   ++fSize;
+}
+
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -571,14 +664,14 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the member fBinIndex, an
+open-addressing hash table with linear probing (the internal class
+THnSparseBinIndex) that stores the hash and the linear index of each filled
+bin next to each other. The slots following the first slot of the hash are
+probed until an empty one is found; for each slot with the same hash, the
+coordinates of the bin are compared to the coordinates passed to GetBin().
+Two different coordinates can only have the same hash - which is extremely
+unlikely - if the compact bin coordinates are larger than 8 bytes.
 */
 
 
@@ -588,7 +681,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinIndex(0), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -605,7 +698,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinIndex(0), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -615,6 +708,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinIndex;
    delete fCompactCoord;
 }
 
@@ -651,36 +745,25 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// We have been streamed (or reset); set up fBinIndex
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinIndex()
 {
+   if (!fBinIndex)
+      fBinIndex = new THnSparseBinIndex();
+   fBinIndex->Reserve(GetNbins());
+
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinIndex->Add(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -688,12 +771,9 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   if (!fBinIndex)
+      FillBinIndex();
+   fBinIndex->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -791,19 +871,15 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (!fBinIndex)
+      FillBinIndex();
+   for (Long64_t slot = fBinIndex->GetFirstSlot(hash); fBinIndex->GetIndex(slot) >= 0;
+        slot = fBinIndex->GetNextSlot(slot)) {
+      if (fBinIndex->GetHash(slot) != hash) continue;
+      Long64_t linidx = fBinIndex->GetIndex(slot);
+      THnSparseArrayChunk* chunk = GetChunk(linidx / fChunkSize);
+      if (chunk->Matches(linidx % fChunkSize, cc->GetBuffer()))
+         return linidx;
    }
    if (!allocate) return -1;
 
@@ -820,16 +896,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinIndex->Add(hash, newidx);
    return newidx;
 }
 
@@ -881,7 +948,8 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   if (fBinIndex)
+      size += 2 * sizeof(Long64_t) * fBinIndex->GetCapacity() /* THnSparseBinIndex */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -963,8 +1031,8 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   delete fBinIndex;
+   fBinIndex = 0;
    fBinContent.Delete();
    ResetBase(option);
 }
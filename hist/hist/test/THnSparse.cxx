@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+
+#include "THnSparse.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+#include <memory>
+
+// Fill a sparse histogram with random bins; with 8 axes of 1000 bins the compact
+// coordinates do not fit into 8 bytes, so the bins are looked up by hash.
+static void FillRandom(THnSparse &hs, Int_t nfill, UInt_t seed)
+{
+   TRandom3 rng(seed);
+   Double_t x[8];
+   for (Int_t i = 0; i < nfill; ++i) {
+      for (Int_t d = 0; d < hs.GetNdimensions(); ++d)
+         x[d] = rng.Uniform(-0.1, 1.1);
+      hs.Fill(x, 1. + (i % 3));
+   }
+}
+
+static THnSparseD *CreateSparse(const char *name, Int_t nbins)
+{
+   Int_t bins[8];
+   Double_t xmin[8];
+   Double_t xmax[8];
+   for (Int_t d = 0; d < 8; ++d) {
+      bins[d] = nbins;
+      xmin[d] = 0.;
+      xmax[d] = 1.;
+   }
+   return new THnSparseD(name, name, 8, bins, xmin, xmax, 1024);
+}
+
+// Every filled bin is found again from its coordinates
+TEST(THnSparse, GetBin) {
+   for (Int_t nbins : {10, 1000}) {
+      std::unique_ptr<THnSparseD> hs(CreateSparse("hs", nbins));
+      FillRandom(*hs, 20000, 1);
+      EXPECT_GT(hs->GetNbins(), 0);
+      EXPECT_LE(hs->GetNbins(), 20000);
+
+      Int_t coord[8];
+      Double_t sum = 0.;
+      for (Long64_t i = 0; i < hs->GetNbins(); ++i) {
+         sum += hs->GetBinContent(i, coord);
+         EXPECT_EQ(i, hs->GetBin(coord, kFALSE));
+      }
+      // FillRandom() fills with weights 1, 2, 3, 1, 2, ...
+      EXPECT_DOUBLE_EQ(39999., sum);
+
+      // underflow in all dimensions: not filled
+      for (Int_t d = 0; d < 8; ++d)
+         coord[d] = 0;
+      EXPECT_EQ(-1, hs->GetBin(coord, kFALSE));
+
+      hs->Reset();
+      EXPECT_EQ(0, hs->GetNbins());
+      FillRandom(*hs, 100, 2);
+      for (Long64_t i = 0; i < hs->GetNbins(); ++i) {
+         hs->GetBinContent(i, coord);
+         EXPECT_EQ(i, hs->GetBin(coord, kFALSE));
+      }
+   }
+}
+
+// Merging and cloning (which sets up the bin index from the streamed chunks)
+TEST(THnSparse, MergeAndClone) {
+   std::unique_ptr<THnSparseD> h1(CreateSparse("h1", 1000));
+   std::unique_ptr<THnSparseD> h2(CreateSparse("h2", 1000));
+   std::unique_ptr<THnSparseD> hAll(CreateSparse("hAll", 1000));
+   FillRandom(*h1, 5000, 3);
+   FillRandom(*h2, 5000, 4);
+   FillRandom(*hAll, 5000, 3);
+   FillRandom(*hAll, 5000, 4);
+
+   TList list;
+   list.Add(h2.get());
+   h1->Merge(&list);
+   EXPECT_EQ(hAll->GetNbins(), h1->GetNbins());
+
+   std::unique_ptr<THnSparseD> hClone(static_cast<THnSparseD *>(h1->Clone("hClone")));
+   Int_t coord[8];
+   for (Long64_t i = 0; i < hAll->GetNbins(); ++i) {
+      Double_t content = hAll->GetBinContent(i, coord);
+      EXPECT_DOUBLE_EQ(content, h1->GetBinContent(h1->GetBin(coord, kFALSE)));
+      EXPECT_DOUBLE_EQ(content, hClone->GetBinContent(hClone->GetBin(coord, kFALSE)));
+   }
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/TConcurrentFillHist.hxx"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TProfile.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Values filled by thread t into the histograms
+static double X(int t, int i)
+{
+   return ((t * 7919 + i * 104729) % 1000) / 1000.;
+}
+
+static double W(int t, int i)
+{
+   return 1 + (t + i) % 3;
+}
+
+// Fill concurrently from nThreads threads, from more threads than slots, and with FillAtSlot()
+template <class HIST, class FILL>
+void FillFromThreads(ROOT::TConcurrentFillHist<HIST> &hist, int nThreads, int nFills, FILL fill)
+{
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; ++t)
+      threads.emplace_back([&hist, &fill, t, nFills]() {
+         for (int i = 0; i < nFills; ++i)
+            fill(hist, t, i);
+      });
+   for (auto &thread : threads)
+      thread.join();
+}
+
+template <class HIST>
+void ExpectEqualBins(const HIST &h1, const HIST &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+   }
+}
+
+TEST(TConcurrentFillHist, TH1D)
+{
+   const int nThreads = 8, nFills = 10000;
+   auto href = std::make_shared<TH1D>("href", "href", 100, 0, 1);
+   href->SetDirectory(nullptr);
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nFills; ++i)
+         href->Fill(X(t, i), W(t, i));
+
+   auto h = std::make_shared<TH1D>("h", "h", 100, 0, 1);
+   h->SetDirectory(nullptr);
+   {
+      // fewer slots than threads: the threads without slot fill directly
+      ROOT::TConcurrentFillHist<TH1D> hc(h, nThreads / 2);
+      FillFromThreads(hc, nThreads, nFills,
+                      [](ROOT::TConcurrentFillHist<TH1D> &hist, int t, int i) { hist.Fill(X(t, i), W(t, i)); });
+      ExpectEqualBins(*hc.Get(), *href);
+   }
+}
+
+TEST(TConcurrentFillHist, TH3D)
+{
+   const int nThreads = 4, nFills = 10000;
+   auto href = std::make_shared<TH3D>("href", "href", 20, 0, 1, 20, 0, 1, 20, 0, 1);
+   href->SetDirectory(nullptr);
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nFills; ++i)
+         href->Fill(X(t, i), X(t, i + 1), X(t, i + 2));
+
+   auto h = std::make_shared<TH3D>("h", "h", 20, 0, 1, 20, 0, 1, 20, 0, 1);
+   h->SetDirectory(nullptr);
+   ROOT::TConcurrentFillHist<TH3D> hc(h, nThreads);
+   FillFromThreads(hc, nThreads, nFills, [](ROOT::TConcurrentFillHist<TH3D> &hist, int t, int i) {
+      hist.FillAtSlot(t, X(t, i), X(t, i + 1), X(t, i + 2));
+   });
+   ExpectEqualBins(*hc.Get(), *href);
+}
+
+TEST(TConcurrentFillHist, TProfile)
+{
+   const int nThreads = 4, nFills = 10000;
+   auto href = std::make_shared<TProfile>("href", "href", 10, 0, 1);
+   href->SetDirectory(nullptr);
+   for (int t = 0; t < nThreads; ++t)
+      for (int i = 0; i < nFills; ++i)
+         href->Fill(X(t, i), W(t, i));
+
+   auto h = std::make_shared<TProfile>("h", "h", 10, 0, 1);
+   h->SetDirectory(nullptr);
+   ROOT::TConcurrentFillHist<TProfile> hc(h);
+   FillFromThreads(hc, nThreads, nFills,
+                   [](ROOT::TConcurrentFillHist<TProfile> &hist, int t, int i) { hist.Fill(X(t, i), W(t, i)); });
+
+   // a snapshot contains at most the values filled so far
+   auto snapshot = hc.Snapshot();
+   EXPECT_LE(snapshot->GetEntries(), nThreads * nFills);
+
+   ExpectEqualBins(*hc.Get(), *href);
+}
@@ -2,6 +2,10 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1D.h"
+#include "TH2D.h"
+
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -30,3 +34,63 @@ TEST(TH1, StatOverflows)
    EXPECT_EQ(TH1::EStatOverflows::kConsider, h1.GetStatOverflows());
    EXPECT_EQ(TH1::EStatOverflows::kNeutral,  h2.GetStatOverflows());
 }
+
+// Compare the contents and statistics of two histograms
+static void ExpectSameHistos(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   for (Int_t bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+   }
+   Double_t stats1[TH1::kNstat], stats2[TH1::kNstat];
+   h1.GetStats(stats1);
+   h2.GetStats(stats2);
+   for (Int_t i = 0; i < TH1::kNstat; ++i)
+      EXPECT_DOUBLE_EQ(stats1[i], stats2[i]);
+   EXPECT_DOUBLE_EQ(h1.GetEntries(), h2.GetEntries());
+}
+
+// FillN finds the bins of the entries in blocks: it must fill the same bins as Fill
+TEST(TH1, FillN)
+{
+   const Double_t edges[] = {-1., -0.5, 0., 0.1, 0.2, 0.5, 1.5, 3.};
+   TH1D hFix("hFix", "hFix", 40, -1, 3);
+   TH1D hVar("hVar", "hVar", 7, edges);
+   TH1D hFixN("hFixN", "hFixN", 40, -1, 3);
+   TH1D hVarN("hVarN", "hVarN", 7, edges);
+
+   // (x, w) pairs, to be filled with a stride of 2; includes the bin edges and the under/overflows
+   std::vector<Double_t> xw;
+   for (Int_t i = 0; i < 1000; ++i) {
+      xw.push_back(-1.5 + 5. * i / 999);
+      xw.push_back(0.5 + (i % 7));
+   }
+   for (Double_t edge : edges) {
+      xw.push_back(edge);
+      xw.push_back(2.);
+   }
+   const Int_t n = xw.size() / 2;
+   for (Int_t i = 0; i < n; ++i) {
+      hFix.Fill(xw[2 * i], xw[2 * i + 1]);
+      hVar.Fill(xw[2 * i], xw[2 * i + 1]);
+   }
+   hFixN.FillN(n, &xw[0], &xw[1], 2);
+   hVarN.FillN(n, &xw[0], &xw[1], 2);
+   ExpectSameHistos(hFix, hFixN);
+   ExpectSameHistos(hVar, hVarN);
+
+   // (x, y, w) triplets, to be filled with a stride of 3
+   std::vector<Double_t> xyw;
+   for (Int_t i = 0; i < n; ++i) {
+      xyw.push_back(xw[2 * i]);
+      xyw.push_back(xw[2 * (n - 1 - i)]);
+      xyw.push_back(xw[2 * i + 1]);
+   }
+   TH2D h2("h2", "h2", 40, -1, 3, 7, edges);
+   TH2D h2N("h2N", "h2N", 40, -1, 3, 7, edges);
+   for (Int_t i = 0; i < n; ++i)
+      h2.Fill(xyw[3 * i], xyw[3 * i + 1], xyw[3 * i + 2]);
+   h2N.FillN(n, &xyw[0], &xyw[1], &xyw[2], 3);
+   ExpectSameHistos(h2, h2N);
+}
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+
+#include "TH2Poly.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+// Bin containing (x,y) found by looping over all bins, -5 if none
+static Int_t FindBinBruteForce(TH2Poly &h, Double_t x, Double_t y)
+{
+   TIter next(h.GetBins());
+   TH2PolyBin *bin;
+   while ((bin = (TH2PolyBin *)next())) {
+      if (bin->IsInside(x, y)) return bin->GetBinNumber();
+   }
+   return -5;
+}
+
+// Add n random triangles of size up to size in [0,10]x[0,10]
+static void AddTriangles(TH2Poly &h, Int_t n, Double_t size, TRandom &rnd)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      Double_t x0 = rnd.Uniform(0, 10 - size), y0 = rnd.Uniform(0, 10 - size);
+      Double_t x[] = {x0, x0 + rnd.Uniform(0, size), x0 + rnd.Uniform(0, size)};
+      Double_t y[] = {y0 + rnd.Uniform(0, size), y0, y0 + size};
+      h.AddBin(3, x, y);
+   }
+}
+
+// FindBin and Fill must find the first bin containing the point, as the search through all bins
+TEST(TH2Poly, FindBin)
+{
+   TRandom3 rnd(1);
+   TH2Poly h("h", "h", 0, 10, 0, 10);
+   AddTriangles(h, 2000, 0.5, rnd); // small overlapping bins
+   AddTriangles(h, 20, 8, rnd);     // large bins overlapping most others
+
+   for (Int_t i = 0; i < 20000; ++i) {
+      Double_t x = rnd.Uniform(0.01, 10), y = rnd.Uniform(0.01, 10);
+      Int_t bin = FindBinBruteForce(h, x, y);
+      EXPECT_EQ(bin, h.FindBin(x, y));
+      EXPECT_EQ(bin, h.Fill(x, y));
+   }
+   EXPECT_EQ(-1, h.FindBin(-1, 11));
+   EXPECT_EQ(-9, h.FindBin(11, -1));
+
+}
+
+// The bins added after a fill are found
+TEST(TH2Poly, AddBinAfterFill)
+{
+   TH2Poly h("h", "h", 0, 10, 0, 10);
+   h.AddBin(0, 0, 5, 5);
+   EXPECT_EQ(1, h.Fill(1, 1));
+   EXPECT_EQ(-5, h.Fill(6, 6));
+   h.AddBin(5, 5, 10, 10);
+   EXPECT_EQ(2, h.Fill(6, 6));
+   EXPECT_DOUBLE_EQ(1, h.GetBinContent(2));
+}
+
+// The bins are accessed by number; Merge adds the contents
+TEST(TH2Poly, Merge)
+{
+   TH2Poly h1("h1", "h1", 0, 10, 0, 10);
+   TH2Poly h2("h2", "h2", 0, 10, 0, 10);
+   for (Int_t i = 0; i < 10; ++i) {
+      for (Int_t j = 0; j < 10; ++j) {
+         h1.AddBin(i, j, i + 1, j + 1);
+         h2.AddBin(i, j, i + 1, j + 1);
+      }
+   }
+   for (Int_t bin = 1; bin <= 100; ++bin) {
+      h1.SetBinContent(bin, bin);
+      h2.SetBinContent(bin, 2 * bin);
+   }
+   h1.Fill(0.5, 0.5, 10);
+   h2.Fill(9.5, 9.5, 10);
+
+   TList list;
+   list.Add(&h2);
+   h1.Merge(&list);
+   EXPECT_DOUBLE_EQ(3 + 10, h1.GetBinContent(1));
+   EXPECT_DOUBLE_EQ(3 * 50, h1.GetBinContent(50));
+   EXPECT_DOUBLE_EQ(3 * 100 + 10, h1.GetBinContent(100));
+}
@@ -22,6 +22,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <memory>
 
 #include "TDirectoryFile.h"
 #include "TMap.h"
@@ -92,6 +93,8 @@ protected:
    TMap            *fCacheReadMap;   ///<!Pointer to the read cache (if any)
    TFileCacheWrite *fCacheWrite;     ///<!Pointer to the write cache (if any)
    Long64_t         fArchiveOffset;  ///<!Offset at which file starts in archive
+   std::shared_ptr<char> fMapping;   ///<!Read-only memory mapping of the file (if any), shared with the baskets using it
+   Long64_t         fMapSize;        ///<!Size of the memory mapping
    Bool_t           fIsArchive : 1;  ///<!True if this is a pure archive file
    Bool_t           fNoAnchorInName : 1; ///<!True if we don't want to force the anchor to be appended to the file name
    Bool_t           fIsRootFile : 1; ///<!True is this is a ROOT file, raw file otherwise
@@ -204,6 +207,7 @@ public:
    virtual void        ResetErrno() const;
    Int_t               GetFd() const { return fD; }
    virtual const TUrl *GetEndpointUrl() const { return &fUrl; }
+   std::shared_ptr<char> GetMappedBuffer(Long64_t pos, Int_t len);
    TObjArray          *GetListOfProcessIDs() const {return fProcessIDs;}
    TList              *GetListOfFree() const { return fFree; }
    virtual Int_t       GetNfree() const { return fFree->GetSize(); }
@@ -228,6 +232,7 @@ public:
    virtual void        IncrementProcessIDs() { fNProcessIDs++; }
    virtual Bool_t      IsArchive() const { return fIsArchive; }
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
+           Bool_t      IsMemoryMapped() const { return fMapping != nullptr; }
            Bool_t      IsRaw() const { return !fIsRootFile; }
    virtual Bool_t      IsOpen() const;
    virtual void        ls(Option_t *option="") const;
@@ -256,6 +261,7 @@ public:
    virtual void        SetCompressionLevel(Int_t level=4);
    virtual void        SetCompressionSettings(Int_t settings=4);
    virtual void        SetEND(Long64_t last) { fEND = last; }
+   Bool_t              SetMemoryMapped(Bool_t map = kTRUE);
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
    virtual void        SetReadCalls(Int_t readcalls = 0) { fReadCalls = readcalls; }
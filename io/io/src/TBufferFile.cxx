@@ -40,8 +40,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TArrayC.h"
 #include "TROOT.h"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
+#ifdef R__BYTESWAP
 #define USE_BSWAPCPY
 #endif
 
@@ -922,8 +921,13 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += sizeof(Long64_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -983,8 +987,13 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += sizeof(Double_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1192,8 +1201,13 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += sizeof(Long64_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1251,8 +1265,13 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += sizeof(Double_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1429,8 +1448,13 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += sizeof(Long64_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &ll[i]);
+# endif
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1468,8 +1492,13 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += sizeof(Double_t)*n;
+# else
    for (int i = 0; i < n; i++)
       frombuf(fBufCur, &d[i]);
+# endif
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1900,8 +1929,13 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, ll[i]);
+# endif
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1955,8 +1989,13 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, d[i]);
+# endif
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2144,8 +2183,13 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, ll[i]);
+# endif
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2187,8 +2231,13 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
+# ifdef USE_BSWAPCPY
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
+# else
    for (int i = 0; i < n; i++)
       tobuf(fBufCur, d[i]);
+# endif
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
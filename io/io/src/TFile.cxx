@@ -84,6 +84,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <sys/stat.h>
 #ifndef WIN32
 #   include <unistd.h>
+#   include <sys/mman.h>
 #else
 #   define ssize_t int
 #   include <io.h>
@@ -188,6 +189,7 @@ TFile::TFile() : TDirectoryFile(), fInfoCache(0)
    fCacheReadMap    = new TMap();
    fCacheWrite      = 0;
    fArchiveOffset   = 0;
+   fMapSize         = 0;
    fReadCalls       = 0;
    fInfoCache       = 0;
    fOpenPhases      = 0;
@@ -388,6 +390,7 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
    fOption.ToUpper();
 
    fArchiveOffset = 0;
+   fMapSize       = 0;
    fIsArchive     = kFALSE;
    fArchive       = 0;
    if (fIsRootFile && !fIsPcmFile && fOption != "NEW" && fOption != "CREATE"
@@ -887,6 +890,11 @@ void TFile::Init(Bool_t create)
       }
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
+
+   // Map local files opened for reading into memory if requested.
+   if (!fWritable && gEnv->GetValue("TFile.MemoryMap", 0)) {
+      SetMemoryMapped(kTRUE);
+   }
    return;
 
 zombie:
@@ -922,6 +930,7 @@ void TFile::Close(Option_t *option)
 
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
+      SetMemoryMapped(kFALSE);
       SysClose(fD);
       fD = -1;
 
@@ -977,6 +986,7 @@ void TFile::Close(Option_t *option)
    }
 
    if (IsOpen()) {
+      SetMemoryMapped(kFALSE);
       SysClose(fD);
       fD = -1;
    }
@@ -1639,6 +1649,83 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the `len` bytes of the file starting at position `pos`,
+/// if the file is memory mapped (see TFile::SetMemoryMapped), or nullptr otherwise.
+/// The returned memory is read-only. It shares the ownership of the mapping,
+/// which stays valid as long as the returned pointer (or a copy) is alive,
+/// even after the file is closed or unmapped. This lets callers (e.g. TBasket
+/// for uncompressed baskets) use the file content in place, without a read
+/// system call or a copy.
+/// The bytes are accounted as read from the file: when reading in parallel,
+/// the caller must hold the ROOT mutex, as for ReadBuffer.
+
+std::shared_ptr<char> TFile::GetMappedBuffer(Long64_t pos, Int_t len)
+{
+   if (!fMapping || pos < 0 || len < 0) return nullptr;
+   Long64_t offset = pos + fArchiveOffset;
+   if (offset + len > fMapSize) return nullptr;
+
+   fBytesRead  += len;
+   fgBytesRead += len;
+   fReadCalls++;
+   fgReadCalls++;
+   if (gPerfStats != 0) {
+      gPerfStats->FileReadEvent(this, len, TTimeStamp());
+   }
+   // Aliasing constructor: points into the mapping, and owns it.
+   return std::shared_ptr<char>(fMapping, fMapping.get() + offset);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map (or unmap if `map` is false) the content of the file into memory.
+///
+/// This is only supported for local files opened in read mode; the mapping
+/// is read-only. Once mapped, the baskets of uncompressed branches are read
+/// directly from the mapped pages, avoiding both the read system call and
+/// the copy into the basket buffer. Mapping can also be requested for all
+/// the files opened in read mode via the TFile.MemoryMap rootrc option.
+/// When unmapping, the pages still used by baskets stay mapped until these
+/// baskets release them.
+/// Returns kTRUE if the file is (un)mapped as requested.
+
+Bool_t TFile::SetMemoryMapped(Bool_t map)
+{
+#ifndef WIN32
+   if (!map) {
+      fMapping.reset();
+      fMapSize = 0;
+      return kTRUE;
+   }
+   if (fMapping) return kTRUE;
+
+   // Only plain local files can be mapped, the other TFile implementations
+   // do not use a local file descriptor.
+   if (IsA() != TFile::Class() || !IsOpen() || IsWritable()) {
+      Warning("SetMemoryMapped", "only local files opened in read mode can be memory mapped");
+      return kFALSE;
+   }
+
+   Long_t id, flags, modtime;
+   Long64_t size;
+   if (SysStat(fD, &id, &size, &flags, &modtime) || size <= 0) {
+      Error("SetMemoryMapped", "cannot stat file %s", GetName());
+      return kFALSE;
+   }
+   void *addr = ::mmap(0, size, PROT_READ, MAP_SHARED, fD, 0);
+   if (addr == MAP_FAILED) {
+      SysError("SetMemoryMapped", "cannot map file %s", GetName());
+      return kFALSE;
+   }
+   fMapping.reset((char *)addr, [size](char *p) { ::munmap(p, size); });
+   fMapSize = size;
+   return kTRUE;
+#else
+   if (map) Warning("SetMemoryMapped", "memory mapped files are not supported on this platform");
+   return !map;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read a buffer from the file. This is the basic low level read operation.
 /// Returns kTRUE in case of failure.
@@ -2047,6 +2134,9 @@ Int_t TFile::ReOpen(Option_t *mode)
    if (opt == fOption || (opt == "UPDATE" && fOption == "CREATE"))
       return 1;
 
+   // The mapping is read-only and tied to the current file descriptor.
+   SetMemoryMapped(kFALSE);
+
    if (opt == "READ") {
       // switch to READ mode
 
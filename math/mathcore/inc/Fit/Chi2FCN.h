@@ -67,7 +67,8 @@ public:
       BaseFCN( data, func),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func->NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    { }
 
    /**
@@ -78,13 +79,14 @@ public:
       BaseFCN(std::shared_ptr<BinData>(const_cast<BinData*>(&data), DummyDeleter<BinData>()), std::shared_ptr<IModelFunction>(dynamic_cast<IModelFunction*>(func.Clone() ) ) ),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func.NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    { }
 
    /**
       Destructor (no operations)
    */
-   virtual ~Chi2FCN ()  {}
+   virtual ~Chi2FCN () {}
    /**
       Copy constructor
    */
@@ -92,7 +94,8 @@ public:
       BaseFCN(f.DataPtr(), f.ModelFunctionPtr() ),
       fNEffPoints( f.fNEffPoints ),
       fGrad( f.fGrad),
-      fExecutionPolicy(f.fExecutionPolicy)
+      fExecutionPolicy(f.fExecutionPolicy),
+      fProcessPool(f.fProcessPool)
    {  }
 
    /**
@@ -103,6 +106,7 @@ public:
       SetModelFunction(rhs.ModelFunctionPtr() );
       fNEffPoints = rhs.fNEffPoints;
       fGrad = rhs.fGrad;
+      fProcessPool = rhs.fProcessPool;
    }
 
    /*
@@ -127,7 +131,7 @@ public:
    virtual void Gradient(const double *x, double *g) const {
       // evaluate the chi2 gradient
       FitUtil::Evaluate<T>::EvalChi2Gradient(BaseFCN::ModelFunction(), BaseFCN::Data(), x, g, fNEffPoints,
-                                             fExecutionPolicy);
+                                             fExecutionPolicy, 0, fProcessPool.get());
    }
 
    /// get type of fit method function
@@ -149,7 +153,8 @@ private:
       if (BaseFCN::Data().HaveCoordErrors() || BaseFCN::Data().HaveAsymErrors())
          return FitUtil::Evaluate<T>::EvalChi2Effective(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fNEffPoints);
       else
-         return FitUtil::Evaluate<T>::EvalChi2(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fNEffPoints, fExecutionPolicy);
+         return FitUtil::Evaluate<T>::EvalChi2(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fNEffPoints,
+                                               fExecutionPolicy, 0, fProcessPool.get());
    }
 
    // for derivatives
@@ -163,6 +168,7 @@ private:
 
    mutable std::vector<double> fGrad; // for derivatives
    ::ROOT::Fit::ExecutionPolicy fExecutionPolicy;
+   std::shared_ptr<FitUtil::ProcessPoolHandle> fProcessPool; // workers of ExecutionPolicy::kMultiprocess, shared by the copies
 
 };
 
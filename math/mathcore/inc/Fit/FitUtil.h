@@ -260,6 +260,21 @@ namespace FitUtil {
      ROOT::Math::IMultiGenFunction *fFuncNDim;
   };
 
+  /**
+      handle of the worker processes evaluating a fit method function with ExecutionPolicy::kMultiprocess.
+      It is owned by the fit method function and shared by its copies: the workers are terminated when the
+      handle is deleted, i.e. when the last copy of the fit method function is deleted.
+  */
+  class ProcessPoolHandle {
+  public:
+     ProcessPoolHandle() {}
+     ~ProcessPoolHandle();
+
+  private:
+     ProcessPoolHandle(const ProcessPoolHandle &) = delete;
+     ProcessPoolHandle &operator=(const ProcessPoolHandle &) = delete;
+  };
+
   /** Chi2 Functions */
 
   /**
@@ -267,7 +282,8 @@ namespace FitUtil {
       return also nPoints as the effective number of used points in the Chi2 evaluation
   */
   double EvaluateChi2(const IModelFunction &func, const BinData &data, const double *x, unsigned int &nPoints,
-                      ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0);
+                      ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                      ProcessPoolHandle *processPool = nullptr);
 
   /**
       evaluate the effective Chi2 given a model function and the data at the point x.
@@ -283,14 +299,15 @@ namespace FitUtil {
   void EvaluateChi2Gradient(const IModelFunction &func, const BinData &data, const double *x, double *grad,
                             unsigned int &nPoints,
                             ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                            unsigned nChunks = 0);
+                            unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr);
 
   /**
       evaluate the LogL given a model function and the data at the point x.
       return also nPoints as the effective number of used points in the LogL evaluation
   */
   double EvaluateLogL(const IModelFunction &func, const UnBinData &data, const double *p, int iWeight, bool extended,
-                      unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0);
+                      unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                      ProcessPoolHandle *processPool = nullptr);
 
   /**
       evaluate the LogL gradient given a model function and the data at the point x.
@@ -299,7 +316,7 @@ namespace FitUtil {
   void EvaluateLogLGradient(const IModelFunction &func, const UnBinData &data, const double *x, double *grad,
                             unsigned int &nPoints,
                             ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                            unsigned nChunks = 0);
+                            unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr);
 
   // #ifdef R__HAS_VECCORE
   //    template <class NotCompileIfScalarBackend = std::enable_if<!(std::is_same<double, ROOT::Double_v>::value)>>
@@ -314,7 +331,7 @@ namespace FitUtil {
   */
   double EvaluatePoissonLogL(const IModelFunction &func, const BinData &data, const double *x, int iWeight,
                              bool extended, unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy,
-                             unsigned nChunks = 0);
+                             unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr);
 
   /**
       evaluate the Poisson LogL given a model function and the data at the point x.
@@ -323,7 +340,7 @@ namespace FitUtil {
   void EvaluatePoissonLogLGradient(const IModelFunction &func, const BinData &data, const double *x, double *grad,
                                    unsigned int &nPoints,
                                    ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                                   unsigned nChunks = 0);
+                                   unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr);
 
   // methods required by dedicate minimizer like Fumili
 
@@ -368,11 +385,41 @@ namespace FitUtil {
 
    unsigned setAutomaticChunking(unsigned nEvents);
 
+#ifdef R__USE_IMT
+   /**
+      sum the nres results of rangeFunction(begin, end, res) over the n points, split in nChunks ranges
+      of consecutive points evaluated in parallel. Used for the gradients: each range accumulates
+      in place the contributions of its points, instead of returning a vector for each point.
+   */
+   template <class T, class RangeFunc>
+   std::vector<T> EvaluateRangesInParallel(const RangeFunc &rangeFunction, unsigned int n, unsigned int nres,
+                                           unsigned int nChunks)
+   {
+      nChunks = std::max(1U, std::min(nChunks, n));
+      auto mapFunction = [&](const unsigned int i) {
+         std::vector<T> res(nres);
+         rangeFunction((unsigned long long)n * i / nChunks, (unsigned long long)n * (i + 1) / nChunks, res.data());
+         return res;
+      };
+      auto redFunction = [&](const std::vector<std::vector<T>> &partialResults) {
+         std::vector<T> result(nres);
+         for (auto const &partialResult : partialResults) {
+            for (unsigned int j = 0; j < nres; ++j)
+               result[j] += partialResult[j];
+         }
+         return result;
+      };
+      ROOT::TThreadExecutor pool;
+      return pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, nChunks), redFunction);
+   }
+#endif
+
    template<class T>
    struct Evaluate {
 #ifdef R__HAS_VECCORE
       static double EvalChi2(const IModelFunctionTempl<T> &func, const BinData &data, const double *p,
-                             unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                             unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                             ProcessPoolHandle * = nullptr)
       {
          // evaluate the chi2 given a  vectorized function reference  , the data and returns the value and also in nPoints
          // the actual number of used points
@@ -490,7 +537,8 @@ namespace FitUtil {
 
       static double EvalLogL(const IModelFunctionTempl<T> &func, const UnBinData &data, const double *const p,
                              int iWeight, bool extended, unsigned int &nPoints,
-                             ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                             ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                             ProcessPoolHandle * = nullptr)
       {
          // evaluate the LogLikelihood
          unsigned int n = data.Size();
@@ -755,7 +803,8 @@ namespace FitUtil {
 
       static double EvalPoissonLogL(const IModelFunctionTempl<T> &func, const BinData &data, const double *p,
                                     int iWeight, bool extended, unsigned int,
-                                    ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                                    ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                                    ProcessPoolHandle * = nullptr)
       {
          // evaluate the Poisson Log Likelihood
          // for binned likelihood fits
@@ -912,7 +961,7 @@ namespace FitUtil {
       static void EvalChi2Gradient(const IModelFunctionTempl<T> &f, const BinData &data, const double *p, double *grad,
                                    unsigned int &nPoints,
                                    ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                                   unsigned nChunks = 0)
+                                   unsigned nChunks = 0, ProcessPoolHandle * = nullptr)
       {
          // evaluate the gradient of the chi2 function
          // this function is used when the model function knows how to calculate the derivative and we can
@@ -1014,16 +1063,13 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &partialResults) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : partialResults) {
+         // Sum the contributions of the vectors of points [begin, end) by adding their equally-indexed components
+         auto rangeFunction = [&](unsigned int begin, unsigned int end, T *res) {
+            for (unsigned int i = begin; i < end; ++i) {
+               auto pointContributionVec = mapFunction(i);
                for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
+                  res[parameterIndex] += pointContributionVec[parameterIndex];
             }
-
-            return result;
          };
 
          std::vector<T> gVec(npar);
@@ -1043,18 +1089,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            std::vector<std::vector<T>> allGradients(numVectors);
-            for (unsigned int i = 0; i < numVectors; ++i) {
-               allGradients[i] = mapFunction(i);
-            }
-
-            gVec = redFunction(allGradients);
+            rangeFunction(0, numVectors, gVec.data());
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            ROOT::TThreadExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = EvaluateRangesInParallel<T>(rangeFunction, numVectors, npar, chunks);
          }
 #endif
          // else if(executionPolicy == ROOT::Fit::kMultiprocess){
@@ -1122,7 +1162,7 @@ namespace FitUtil {
       EvalPoissonLogLGradient(const IModelFunctionTempl<T> &f, const BinData &data, const double *p, double *grad,
                               unsigned int &,
                               ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                              unsigned nChunks = 0)
+                              unsigned nChunks = 0, ProcessPoolHandle * = nullptr)
       {
          // evaluate the gradient of the Poisson log likelihood function
 
@@ -1206,16 +1246,13 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Vertically reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &partialResults) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : partialResults) {
+         // Sum the contributions of the vectors of points [begin, end) by adding their equally-indexed components
+         auto rangeFunction = [&](unsigned int begin, unsigned int end, T *res) {
+            for (unsigned int i = begin; i < end; ++i) {
+               auto pointContributionVec = mapFunction(i);
                for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
+                  res[parameterIndex] += pointContributionVec[parameterIndex];
             }
-
-            return result;
          };
 
          std::vector<T> gVec(npar);
@@ -1234,18 +1271,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            std::vector<std::vector<T>> allGradients(numVectors);
-            for (unsigned int i = 0; i < numVectors; ++i) {
-               allGradients[i] = mapFunction(i);
-            }
-
-            gVec = redFunction(allGradients);
+            rangeFunction(0, numVectors, gVec.data());
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            ROOT::TThreadExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = EvaluateRangesInParallel<T>(rangeFunction, numVectors, npar, chunks);
          }
 #endif
          // else if(executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess){
@@ -1285,7 +1316,7 @@ namespace FitUtil {
       static void EvalLogLGradient(const IModelFunctionTempl<T> &f, const UnBinData &data, const double *p,
                                    double *grad, unsigned int &,
                                    ROOT::Fit::ExecutionPolicy executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial,
-                                   unsigned nChunks = 0)
+                                   unsigned nChunks = 0, ProcessPoolHandle * = nullptr)
       {
          // evaluate the gradient of the log likelihood function
 
@@ -1363,16 +1394,13 @@ namespace FitUtil {
             return pointContributionVec;
          };
 
-         // Vertically reduce the set of vectors by summing its equally-indexed components
-         auto redFunction = [&](const std::vector<std::vector<T>> &pointContributions) {
-            std::vector<T> result(npar);
-
-            for (auto const &pointContributionVec : pointContributions) {
+         // Sum the contributions of the vectors of points [begin, end) by adding their equally-indexed components
+         auto rangeFunction = [&](unsigned int begin, unsigned int end, T *res) {
+            for (unsigned int i = begin; i < end; ++i) {
+               auto pointContributionVec = mapFunction(i);
                for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-                  result[parameterIndex] += pointContributionVec[parameterIndex];
+                  res[parameterIndex] += pointContributionVec[parameterIndex];
             }
-
-            return result;
          };
 
          std::vector<T> gVec(npar);
@@ -1392,17 +1420,12 @@ namespace FitUtil {
 #endif
 
          if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-            std::vector<std::vector<T>> allGradients(numVectors);
-            for (unsigned int i = 0; i < numVectors; ++i) {
-               allGradients[i] = mapFunction(i);
-            }
-            gVec = redFunction(allGradients);
+            rangeFunction(0, numVectors, gVec.data());
          }
 #ifdef R__USE_IMT
          else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
             auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(numVectors);
-            ROOT::TThreadExecutor pool;
-            gVec = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, numVectors), redFunction, chunks);
+            gVec = EvaluateRangesInParallel<T>(rangeFunction, numVectors, npar, chunks);
          }
 #endif
          // else if(executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess){
@@ -1445,7 +1468,8 @@ namespace FitUtil {
 #endif
 
       static double EvalChi2(const IModelFunction &func, const BinData &data, const double *p, unsigned int &nPoints,
-                             ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                             ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                             ProcessPoolHandle *processPool = nullptr)
       {
          // evaluate the chi2 given a  function reference, the data and returns the value and also in nPoints
          // the actual number of used points
@@ -1455,21 +1479,24 @@ namespace FitUtil {
 
          //Info("EvalChi2","Using non-vecorized implementation %d",(int) data.Opt().fIntegral);
 
-         return FitUtil::EvaluateChi2(func, data, p, nPoints, executionPolicy, nChunks);
+         return FitUtil::EvaluateChi2(func, data, p, nPoints, executionPolicy, nChunks, processPool);
       }
 
       static double EvalLogL(const IModelFunctionTempl<double> &func, const UnBinData &data, const double *p,
                              int iWeight, bool extended, unsigned int &nPoints,
-                             ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                             ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                             ProcessPoolHandle *processPool = nullptr)
       {
-         return FitUtil::EvaluateLogL(func, data, p, iWeight, extended, nPoints, executionPolicy, nChunks);
+         return FitUtil::EvaluateLogL(func, data, p, iWeight, extended, nPoints, executionPolicy, nChunks, processPool);
       }
 
       static double EvalPoissonLogL(const IModelFunctionTempl<double> &func, const BinData &data, const double *p,
                                     int iWeight, bool extended, unsigned int &nPoints,
-                                    ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0)
+                                    ::ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks = 0,
+                                    ProcessPoolHandle *processPool = nullptr)
       {
-         return FitUtil::EvaluatePoissonLogL(func, data, p, iWeight, extended, nPoints, executionPolicy, nChunks);
+         return FitUtil::EvaluatePoissonLogL(func, data, p, iWeight, extended, nPoints, executionPolicy, nChunks,
+                                             processPool);
       }
 
       static double EvalChi2Effective(const IModelFunctionTempl<double> &func, const BinData & data, const double * p, unsigned int &nPoints)
@@ -1479,9 +1506,9 @@ namespace FitUtil {
       static void EvalChi2Gradient(const IModelFunctionTempl<double> &func, const BinData &data, const double *p,
                                    double *g, unsigned int &nPoints,
                                    ::ROOT::Fit::ExecutionPolicy executionPolicy = ::ROOT::Fit::ExecutionPolicy::kSerial,
-                                   unsigned nChunks = 0)
+                                   unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr)
       {
-         FitUtil::EvaluateChi2Gradient(func, data, p, g, nPoints, executionPolicy, nChunks);
+         FitUtil::EvaluateChi2Gradient(func, data, p, g, nPoints, executionPolicy, nChunks, processPool);
       }
       static double EvalChi2Residual(const IModelFunctionTempl<double> &func, const BinData & data, const double * p, unsigned int i, double *g = 0)
       {
@@ -1498,17 +1525,17 @@ namespace FitUtil {
       EvalPoissonLogLGradient(const IModelFunctionTempl<double> &func, const BinData &data, const double *p, double *g,
                               unsigned int &nPoints,
                               ::ROOT::Fit::ExecutionPolicy executionPolicy = ::ROOT::Fit::ExecutionPolicy::kSerial,
-                              unsigned nChunks = 0)
+                              unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr)
       {
-         FitUtil::EvaluatePoissonLogLGradient(func, data, p, g, nPoints, executionPolicy, nChunks);
+         FitUtil::EvaluatePoissonLogLGradient(func, data, p, g, nPoints, executionPolicy, nChunks, processPool);
       }
 
       static void EvalLogLGradient(const IModelFunctionTempl<double> &func, const UnBinData &data, const double *p,
                                    double *g, unsigned int &nPoints,
                                    ::ROOT::Fit::ExecutionPolicy executionPolicy = ::ROOT::Fit::ExecutionPolicy::kSerial,
-                                   unsigned nChunks = 0)
+                                   unsigned nChunks = 0, ProcessPoolHandle *processPool = nullptr)
       {
-         FitUtil::EvaluateLogLGradient(func, data, p, g, nPoints, executionPolicy, nChunks);
+         FitUtil::EvaluateLogLGradient(func, data, p, g, nPoints, executionPolicy, nChunks, processPool);
       }
    };
 
@@ -61,7 +61,8 @@ public:
       fWeight(weight),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func->NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    {}
 
       /**
@@ -73,7 +74,8 @@ public:
       fWeight(weight),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func.NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    {}
 
    /**
@@ -90,7 +92,8 @@ public:
       fWeight( f.fWeight ),
       fNEffPoints( f.fNEffPoints ),
       fGrad( f.fGrad),
-      fExecutionPolicy(f.fExecutionPolicy)
+      fExecutionPolicy(f.fExecutionPolicy),
+      fProcessPool(f.fProcessPool)
    {  }
 
 
@@ -105,6 +108,7 @@ public:
       fIsExtended = rhs.fIsExtended;
       fWeight = rhs.fWeight;
       fExecutionPolicy = rhs.fExecutionPolicy;
+      fProcessPool = rhs.fProcessPool;
    }
 
 
@@ -127,7 +131,7 @@ public:
    virtual void Gradient(const double *x, double *g) const {
       // evaluate the chi2 gradient
       FitUtil::Evaluate<typename BaseFCN::T>::EvalLogLGradient(BaseFCN::ModelFunction(), BaseFCN::Data(), x, g,
-                                                               fNEffPoints, fExecutionPolicy);
+                                                               fNEffPoints, fExecutionPolicy, 0, fProcessPool.get());
    }
 
    /// get type of fit method function
@@ -154,7 +158,8 @@ private:
     */
    virtual double DoEval (const double * x) const {
       this->UpdateNCalls();
-      return FitUtil::Evaluate<T>::EvalLogL(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fWeight, fIsExtended, fNEffPoints, fExecutionPolicy);
+      return FitUtil::Evaluate<T>::EvalLogL(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fWeight, fIsExtended,
+                                            fNEffPoints, fExecutionPolicy, 0, fProcessPool.get());
    }
 
    // for derivatives
@@ -174,6 +179,7 @@ private:
    mutable std::vector<double> fGrad; // for derivatives
 
    ::ROOT::Fit::ExecutionPolicy fExecutionPolicy; // Execution policy
+   std::shared_ptr<FitUtil::ProcessPoolHandle> fProcessPool; // workers of ExecutionPolicy::kMultiprocess, shared by the copies
 };
       // define useful typedef's
       // using LogLikelihoodFunction_v = LogLikelihoodFCN<ROOT::Math::IMultiGenFunction, ROOT::Math::IParametricFunctionMultiDimTempl<T>>;
@@ -66,7 +66,8 @@ public:
       fWeight(weight),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func->NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    { }
 
    /**
@@ -78,7 +79,8 @@ public:
       fWeight(weight),
       fNEffPoints(0),
       fGrad ( std::vector<double> ( func.NPar() ) ),
-      fExecutionPolicy(executionPolicy)
+      fExecutionPolicy(executionPolicy),
+      fProcessPool(std::make_shared<FitUtil::ProcessPoolHandle>())
    { }
 
 
@@ -96,7 +98,8 @@ public:
       fWeight( f.fWeight ),
       fNEffPoints( f.fNEffPoints ),
       fGrad( f.fGrad),
-      fExecutionPolicy(f.fExecutionPolicy)
+      fExecutionPolicy(f.fExecutionPolicy),
+      fProcessPool(f.fProcessPool)
    {  }
 
    /**
@@ -110,6 +113,7 @@ public:
       fIsExtended = rhs.fIsExtended;
       fWeight = rhs.fWeight;
       fExecutionPolicy = rhs.fExecutionPolicy;
+      fProcessPool = rhs.fProcessPool;
    }
 
 
@@ -130,7 +134,7 @@ public:
    {
       // evaluate the Poisson gradient
       FitUtil::Evaluate<typename BaseFCN::T>::EvalPoissonLogLGradient(BaseFCN::ModelFunction(), BaseFCN::Data(), x, g,
-                                                                      fNEffPoints, fExecutionPolicy);
+                                                                      fNEffPoints, fExecutionPolicy, 0, fProcessPool.get());
    }
 
    /// get type of fit method function
@@ -164,7 +168,7 @@ private:
    virtual double DoEval (const double * x) const {
       this->UpdateNCalls();
       return FitUtil::Evaluate<T>::EvalPoissonLogL(BaseFCN::ModelFunction(), BaseFCN::Data(), x, fWeight, fIsExtended,
-                                                   fNEffPoints, fExecutionPolicy);
+                                                   fNEffPoints, fExecutionPolicy, 0, fProcessPool.get());
    }
 
    // for derivatives
@@ -184,6 +188,7 @@ private:
    mutable std::vector<double> fGrad; // for derivatives
 
    ::ROOT::Fit::ExecutionPolicy fExecutionPolicy; // Execution policy
+   std::shared_ptr<FitUtil::ProcessPoolHandle> fProcessPool; // workers of ExecutionPolicy::kMultiprocess, shared by the copies
 };
 
       // define useful typedef's
@@ -0,0 +1,312 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2018  LCG ROOT Math Team, CERN/EP-SFT                *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Implementation of the worker processes used by ExecutionPolicy::kMultiprocess
+//
+// The workers are forked, as done by ROOT::TProcessExecutor, but they are kept
+// alive between the evaluations of the fit method function: the data are only
+// copied once (by the fork) and each evaluation only exchanges the parameter
+// values and the partial sums through a socket per worker.
+
+#include "FitProcessPool.h"
+
+#include "Fit/FitUtil.h"
+
+#include "Math/Error.h"
+
+#include "TROOT.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace ROOT {
+
+   namespace Fit {
+
+      namespace FitUtil {
+
+namespace {
+
+#ifndef _WIN32
+
+/// Send len bytes, without raising SIGPIPE if the other side is gone.
+bool SendAll(int fd, const void *buf, size_t len)
+{
+   auto ptr = static_cast<const char *>(buf);
+#ifdef MSG_NOSIGNAL
+   const int flags = MSG_NOSIGNAL;
+#else
+   const int flags = 0;
+#endif
+   while (len > 0) {
+      auto n = send(fd, ptr, len, flags);
+      if (n < 0 && errno == EINTR)
+         continue;
+      if (n <= 0)
+         return false;
+      ptr += n;
+      len -= n;
+   }
+   return true;
+}
+
+/// Receive len bytes; false at end of file or on error.
+bool RecvAll(int fd, void *buf, size_t len)
+{
+   auto ptr = static_cast<char *>(buf);
+   while (len > 0) {
+      auto n = recv(fd, ptr, len, 0);
+      if (n < 0 && errno == EINTR)
+         continue;
+      if (n <= 0)
+         return false;
+      ptr += n;
+      len -= n;
+   }
+   return true;
+}
+
+/// The worker processes evaluating one fit method function on one data set.
+class ProcessPool {
+public:
+   ProcessPool(unsigned int nin, unsigned int nres) : fNIn(nin), fNRes(nres) {}
+
+   ~ProcessPool()
+   {
+      for (auto &w : fWorkers) {
+         // closing the socket makes the worker exit, unless it is busy
+         close(w.fSocket);
+         kill(w.fPid, SIGTERM);
+         waitpid(w.fPid, nullptr, 0);
+      }
+   }
+
+   /// Fork nWorkers workers sharing the n data points; `inherited` are the
+   /// sockets of the other pools, that the workers must not keep open.
+   bool Start(unsigned int n, unsigned int nWorkers, const RangeFunction &evalRange, const std::vector<int> &inherited)
+   {
+      for (unsigned int i = 0; i < nWorkers; ++i) {
+         int fds[2];
+         if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+            return false;
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+         int one = 1;
+         setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+         const unsigned int begin = (unsigned long long)n * i / nWorkers;
+         const unsigned int end = (unsigned long long)n * (i + 1) / nWorkers;
+         const pid_t pid = fork();
+         if (pid < 0) {
+            close(fds[0]);
+            close(fds[1]);
+            return false;
+         }
+         if (pid == 0) {
+            // worker: only keep its own socket, so that the others see the end of file when the
+            // master closes them
+            close(fds[0]);
+            for (auto fd : inherited)
+               close(fd);
+            for (auto &w : fWorkers)
+               close(w.fSocket);
+            Work(fds[1], begin, end, evalRange);
+         }
+         close(fds[1]);
+         fWorkers.push_back({pid, fds[0]});
+      }
+      return true;
+   }
+
+   /// Send the input values to all the workers and add up their results.
+   bool Evaluate(const double *in, double *res)
+   {
+      for (auto &w : fWorkers) {
+         if (!SendAll(w.fSocket, in, fNIn * sizeof(double)))
+            return false;
+      }
+      std::vector<double> sum(fNRes), partial(fNRes);
+      for (auto &w : fWorkers) {
+         if (!RecvAll(w.fSocket, partial.data(), fNRes * sizeof(double)))
+            return false;
+         for (unsigned int j = 0; j < fNRes; ++j)
+            sum[j] += partial[j];
+      }
+      for (unsigned int j = 0; j < fNRes; ++j)
+         res[j] += sum[j];
+      return true;
+   }
+
+   void GetSockets(std::vector<int> &sockets) const
+   {
+      for (auto &w : fWorkers)
+         sockets.push_back(w.fSocket);
+   }
+
+private:
+   struct Worker {
+      pid_t fPid;
+      int fSocket;
+   };
+
+   /// Loop of a worker process: evaluate its points for each set of input
+   /// values received, until the master closes the socket.
+   [[noreturn]] void Work(int fd, unsigned int begin, unsigned int end, const RangeFunction &evalRange)
+   {
+      int status = 0;
+      try {
+         std::vector<double> in(fNIn);
+         std::vector<double> res(fNRes);
+         while (RecvAll(fd, in.data(), fNIn * sizeof(double))) {
+            std::fill(res.begin(), res.end(), 0.);
+            evalRange(in.data(), begin, end, res.data());
+            if (!SendAll(fd, res.data(), fNRes * sizeof(double)))
+               break;
+         }
+      } catch (...) {
+         status = 1;
+      }
+      // do not run the atexit handlers and static destructors of the master
+      _exit(status);
+   }
+
+   unsigned int fNIn;
+   unsigned int fNRes;
+   std::vector<Worker> fWorkers;
+};
+
+typedef std::tuple<std::string, const ProcessPoolHandle *, unsigned int, unsigned int, unsigned int> PoolKey;
+
+std::map<PoolKey, std::unique_ptr<ProcessPool>> &GetPools()
+{
+   static std::map<PoolKey, std::unique_ptr<ProcessPool>> pools;
+   return pools;
+}
+
+#endif // _WIN32
+
+std::mutex &GetPoolsMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
+/// The handles whose fit method functions fell back to the serial evaluation: it is
+/// reported once, and the workers are not started again.
+std::set<const ProcessPoolHandle *> &GetSerialHandles()
+{
+   static std::set<const ProcessPoolHandle *> handles;
+   return handles;
+}
+
+/// Report that the evaluation with the given handle is done serially from now on.
+void FallBackToSerial(const ProcessPoolHandle *handle, const char *reason)
+{
+   GetSerialHandles().insert(handle);
+   std::string msg(reason);
+   msg += ": changing to ROOT::Fit::ExecutionPolicy::kSerial";
+   MATH_ERROR_MSG("FitUtil::EvaluateInProcesses", msg.c_str());
+}
+
+} // end anonymous namespace
+
+bool EvaluateInProcesses(const char *method, ProcessPoolHandle *handle, unsigned int nin, unsigned int n,
+                         const double *in, unsigned int nres, const RangeFunction &evalRange, double *res)
+{
+   if (!handle) {
+      MATH_ERROR_MSG("FitUtil::EvaluateInProcesses",
+                     "ExecutionPolicy::kMultiprocess is only supported by the fit method functions (e.g. Chi2FCN): "
+                     "changing to ROOT::Fit::ExecutionPolicy::kSerial");
+      return false;
+   }
+
+   std::lock_guard<std::mutex> lock(GetPoolsMutex());
+   if (GetSerialHandles().count(handle))
+      return false;
+
+#ifndef _WIN32
+   if (n == 0)
+      return true;
+
+   auto &pools = GetPools();
+   const PoolKey key(method, handle, nin, n, nres);
+   auto it = pools.find(key);
+   if (it == pools.end()) {
+      // the threads of the pool would not exist in the forked workers, which could deadlock
+      if (ROOT::IsImplicitMTEnabled()) {
+         FallBackToSerial(handle, "ExecutionPolicy::kMultiprocess cannot be used while implicit multi-threading "
+                                  "is enabled");
+         return false;
+      }
+      std::vector<int> inherited;
+      for (auto &pool : pools)
+         pool.second->GetSockets(inherited);
+      const unsigned int nWorkers = std::max(1U, std::min(n, std::thread::hardware_concurrency()));
+      std::unique_ptr<ProcessPool> pool(new ProcessPool(nin, nres));
+      if (!pool->Start(n, nWorkers, evalRange, inherited)) {
+         FallBackToSerial(handle, "Cannot start the worker processes");
+         return false;
+      }
+      it = pools.emplace(key, std::move(pool)).first;
+   }
+
+   if (!it->second->Evaluate(in, res)) {
+      pools.erase(it);
+      FallBackToSerial(handle, "Lost the connection to the worker processes");
+      return false;
+   }
+   return true;
+#else
+   (void)method;
+   (void)nin;
+   (void)n;
+   (void)in;
+   (void)nres;
+   (void)evalRange;
+   (void)res;
+   FallBackToSerial(handle, "ExecutionPolicy::kMultiprocess is not supported on Windows");
+   return false;
+#endif
+}
+
+ProcessPoolHandle::~ProcessPoolHandle()
+{
+   std::lock_guard<std::mutex> lock(GetPoolsMutex());
+   GetSerialHandles().erase(this);
+#ifndef _WIN32
+   auto &pools = GetPools();
+   for (auto it = pools.begin(); it != pools.end();) {
+      if (std::get<1>(it->first) == this)
+         it = pools.erase(it);
+      else
+         ++it;
+   }
+#endif
+}
+
+      } // end namespace FitUtil
+
+   } // end namespace Fit
+
+} // end namespace ROOT
@@ -0,0 +1,59 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2018  LCG ROOT Math Team, CERN/EP-SFT                *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for the worker processes used by ExecutionPolicy::kMultiprocess
+
+#ifndef ROOT_Fit_FitProcessPool
+#define ROOT_Fit_FitProcessPool
+
+#include <functional>
+
+namespace ROOT {
+
+   namespace Fit {
+
+      namespace FitUtil {
+
+   class ProcessPoolHandle;
+
+   /// Function evaluating the data points [begin, end) for the input values in
+   /// (the parameters followed by the per-call state of the caller), adding its
+   /// nres results to res.
+   typedef std::function<void(const double *in, unsigned int begin, unsigned int end, double *res)> RangeFunction;
+
+   /**
+      Evaluate the sum over the n data points of a fit method function in
+      worker processes.
+
+      The first call for a given (method, handle) pair forks the workers from
+      the calling function: each of them inherits a copy of the data, of the
+      model function and of the caller stack frame, and evaluates evalRange on
+      its share of the data points. The workers are kept alive, and the
+      following calls only send them the nin input values (the parameters and
+      any state of the caller that can change between calls) and collect their
+      nres partial sums, which are added to res (in a fixed order). The workers
+      are terminated when the handle is deleted. method names the evaluated
+      quantity (e.g. "Chi2" or "Chi2Gradient"), so that the value and the
+      gradient of the same function have their own workers.
+
+      Returns false if the evaluation could not be done in worker processes
+      (no handle, implicit multi-threading enabled, fork failure or Windows);
+      in that case res is not modified and the caller must evaluate the points
+      itself. The reason is reported once per handle.
+   */
+   bool EvaluateInProcesses(const char *method, ProcessPoolHandle *handle, unsigned int nin, unsigned int n,
+                            const double *in, unsigned int nres, const RangeFunction &evalRange, double *res);
+
+      } // end namespace FitUtil
+
+   } // end namespace Fit
+
+} // end namespace ROOT
+
+#endif /* ROOT_Fit_FitProcessPool */
@@ -15,6 +15,8 @@
 #include "Fit/BinData.h"
 #include "Fit/UnBinData.h"
 
+#include "FitProcessPool.h"
+
 #include "Math/IFunctionfwd.h"
 #include "Math/IParamFunction.h"
 #include "Math/Integrator.h"
@@ -224,7 +226,8 @@ namespace ROOT {
 //___________________________________________________________________________________________________________________________
 
       double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, const double *p, unsigned int &,
-                                   ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks)
+                                   ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks,
+                                   ProcessPoolHandle *processPool)
       {
          // evaluate the chi2 given a  function reference  , the data and returns the value and also in nPoints
          // the actual number of used points
@@ -384,6 +387,21 @@ namespace ROOT {
 #endif
 
   double res{};
+  if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+    // the worker processes are forked by the first evaluation and run on their copy of this
+    // stack frame: point p to the parameters they receive
+    auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *r) {
+      p = in;
+      (const_cast<IModelFunction &>(func)).SetParameters(p);
+      igEval.SetParameters(p);
+      for (unsigned int i = begin; i < end; ++i)
+        r[0] += mapFunction(i);
+    };
+    // on failure, the reason has been reported
+    if (!EvaluateInProcesses("Chi2", processPool, func.NPar(), n, p, 1, evalRange, &res))
+      executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+  }
+
   if(executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial){
     for (unsigned int i=0; i<n; ++i) {
       res += mapFunction(i);
@@ -394,11 +412,8 @@ namespace ROOT {
     ROOT::TThreadExecutor pool;
     res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
 #endif
-//   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
-    // ROOT::TProcessExecutor pool;
-    // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-  } else{
-    Error("FitUtil::EvaluateChi2","Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n");
+  } else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+    Error("FitUtil::EvaluateChi2","Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
   }
 
    return res;
@@ -636,7 +651,8 @@ double FitUtil::EvaluateChi2Residual(const IModelFunction & func, const BinData
 }
 
 void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data, const double *p, double *grad,
-                                   unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks)
+                                   unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks,
+                                   ProcessPoolHandle *processPool)
 {
    // evaluate the gradient of the chi2 function
    // this function is used when the model function knows how to calculate the derivative and we can
@@ -674,13 +690,9 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   std::vector<bool> isPointRejected(initialNPoints);
-
-   auto mapFunction = [&](const unsigned int i) {
-      // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
-
+   // add the contribution of the point i to the gradient in res[0..npar) and count in res[npar]
+   // the rejected points; gradFunc and xc are buffers reused for all the points of a range
+   auto pointFunction = [&](const unsigned int i, double *gradFunc, std::vector<double> &xc, double *res) {
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.Error(i);
@@ -690,7 +702,6 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
 
       unsigned int ndim = data.NDim();
       double binVolume = 1;
@@ -720,13 +731,13 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 
       if (!useBinIntegral) {
          fval = func(x, p);
-         func.ParameterGradient(x, p, &gradFunc[0]);
+         func.ParameterGradient(x, p, gradFunc);
       } else {
          auto x2 = data.BinUpEdge(i);
          // calculate normalized integral and gradient (divided by bin volume)
          // need to set function and parameters here in case loop is parallelized
          fval = igEval(x, x2);
-         CalculateGradientIntegral(func, x, x2, p, &gradFunc[0]);
+         CalculateGradientIntegral(func, x, x2, p, gradFunc);
       }
       if (useBinVolume)
          fval *= binVolume;
@@ -738,9 +749,9 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       std::cout << "\tfval = " << fval << std::endl;
 #endif
       if (!CheckInfNaNValue(fval)) {
-         isPointRejected[i] = true;
-         // Return a zero contribution to all partial derivatives on behalf of the current point
-         return pointContribution;
+         // no contribution to the partial derivatives from the current point
+         res[npar] += 1;
+         return;
       }
 
       // loop on the parameters
@@ -758,31 +769,25 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
             break; // exit loop on parameters
          }
 
-         // calculate derivative point contribution
-         pointContribution[ipar] = -2.0 * (y - fval) * invError * invError * gradFunc[ipar];
+         // add derivative point contribution
+         res[ipar] += -2.0 * (y - fval) * invError * invError * gradFunc[ipar];
       }
 
       if (ipar < npar) {
          // case loop was broken for an overflow in the gradient calculation
-         isPointRejected[i] = true;
+         res[npar] += 1;
       }
-
-      return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
+   auto rangeFunction = [&](unsigned int begin, unsigned int end, double *res) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> xc;
+      for (unsigned int i = begin; i < end; ++i)
+         pointFunction(i, gradFunc.data(), xc, res);
    };
 
-   std::vector<double> g(npar);
+   // gradient followed by the number of rejected points
+   std::vector<double> g(npar + 1);
 
 #ifndef R__USE_IMT
    // If IMT is disabled, force the execution policy to the serial case
@@ -793,27 +798,33 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    }
 #endif
 
+   if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+      // the worker processes are forked by the first evaluation and run on their copy of this
+      // stack frame: point p to the parameters they receive
+      auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *res) {
+         p = in;
+         (const_cast<IGradModelFunction &>(func)).SetParameters(p);
+         igEval.SetParameters(p);
+         rangeFunction(begin, end, res);
+      };
+      // on failure, the reason has been reported
+      if (!EvaluateInProcesses("Chi2Gradient", processPool, npar, initialNPoints, p, npar + 1, evalRange, g.data()))
+         executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+   }
+
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      rangeFunction(0, initialNPoints, g.data());
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      ROOT::TThreadExecutor pool;
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = EvaluateRangesInParallel<double>(rangeFunction, initialNPoints, npar + 1, chunks);
    }
 #endif
-   // else if(executionPolicy == ROOT::Fit::kMultiprocess){
-   //    ROOT::TProcessExecutor pool;
-   //    g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   // }
-   else {
+   else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
       Error("FitUtil::EvaluateChi2Gradient",
-            "Execution policy unknown. Avalaible choices:\n 0: Serial (default)\n 1: MultiThread (requires IMT)\n");
+            "Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n "
+            "ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
    }
 
 #ifndef R__USE_IMT
@@ -824,8 +835,8 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    // correct the number of points
    nPoints = initialNPoints;
 
-   if (std::any_of(isPointRejected.begin(), isPointRejected.end(), [](bool point) { return point; })) {
-      unsigned nRejected = std::accumulate(isPointRejected.begin(), isPointRejected.end(), 0);
+   unsigned nRejected = g[npar];
+   if (nRejected > 0) {
       assert(nRejected <= initialNPoints);
       nPoints = initialNPoints - nRejected;
 
@@ -835,7 +846,7 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
    }
 
    // copy result
-   std::copy(g.begin(), g.end(), grad);
+   std::copy(g.begin(), g.begin() + npar, grad);
 }
 
 //______________________________________________________________________________________________________
@@ -897,7 +908,8 @@ double FitUtil::EvaluatePdf(const IModelFunction & func, const UnBinData & data,
 
 double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBinData &data, const double *p,
                              int iWeight, bool extended, unsigned int &nPoints,
-                             ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks)
+                             ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks,
+                             ProcessPoolHandle *processPool)
 {
    // evaluate the LogLikelihood
 
@@ -1036,6 +1048,42 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
   double logl{};
   double sumW{};
   double sumW2{};
+  if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+    // the worker processes are forked by the first evaluation and run on their copy of this
+    // stack frame: point p to the parameters they receive, and update the state of this call
+    const unsigned int npar = func.NPar();
+    auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *r) {
+      p = in;
+      norm = in[npar];
+      iWeight = static_cast<int>(in[npar + 1]);
+      extended = (in[npar + 2] != 0);
+      // propagate the parameters to the model function by calling it once, as above
+      std::vector<double> x0(data.NDim());
+      for (unsigned int j = 0; j < data.NDim(); ++j)
+        x0[j] = *data.GetCoordComponent(0, j);
+      func(x0.data(), p);
+      for (unsigned int i = begin; i < end; ++i) {
+        auto resArray = mapFunction(i);
+        r[0] += resArray.logvalue;
+        r[1] += resArray.weight;
+        r[2] += resArray.weight2;
+      }
+    };
+    std::vector<double> in(p, p + npar);
+    in.push_back(norm);
+    in.push_back(iWeight);
+    in.push_back(extended);
+    double resArray[3] = {0., 0., 0.};
+    if (EvaluateInProcesses("LogL", processPool, in.size(), n, in.data(), 3, evalRange, resArray)) {
+      logl = resArray[0];
+      sumW = resArray[1];
+      sumW2 = resArray[2];
+    } else {
+      // the reason has been reported
+      executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+    }
+  }
+
   if(executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial){
     for (unsigned int i=0; i<n; ++i) {
       auto resArray = mapFunction(i);
@@ -1052,11 +1100,8 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
     sumW=resArray.weight;
     sumW2=resArray.weight2;
 #endif
-//   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
-    // ROOT::TProcessExecutor pool;
-    // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-  } else{
-    Error("FitUtil::EvaluateLogL","Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n");
+  } else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+    Error("FitUtil::EvaluateLogL","Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
   }
 
   if (extended) {
@@ -1124,7 +1169,8 @@ double FitUtil::EvaluateLogL(const IModelFunctionTempl<double> &func, const UnBi
 }
 
 void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &data, const double *p, double *grad,
-                                   unsigned int &, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks)
+                                   unsigned int &, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks,
+                                   ProcessPoolHandle *processPool)
 {
    // evaluate the gradient of the log likelihood function
 
@@ -1148,13 +1194,10 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
    const double kdmax1 = std::sqrt(std::numeric_limits<double>::max());
    const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
 
-   auto mapFunction = [&](const unsigned int i) {
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
-
-
+   // add the contribution of the point i to the gradient in res; gradFunc and xc are buffers
+   // reused for all the points of a range
+   auto pointFunction = [&](const unsigned int i, double *gradFunc, std::vector<double> &xc, double *res) {
       const double * x = nullptr;
-      std::vector<double> xc;
       if (data.NDim() > 1) {
          xc.resize(data.NDim() );
          for (unsigned int j = 0; j < data.NDim(); ++j)
@@ -1165,7 +1208,7 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
       }
 
       double fval = func(x, p);
-      func.ParameterGradient(x, p, &gradFunc[0]);
+      func.ParameterGradient(x, p, gradFunc);
       
 #ifdef DEBUG
       {
@@ -1180,31 +1223,24 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
 
       for (unsigned int kpar = 0; kpar < npar; ++kpar) {
          if (fval > 0)
-            pointContribution[kpar] = -1. / fval * gradFunc[kpar];
+            res[kpar] += -1. / fval * gradFunc[kpar];
          else if (gradFunc[kpar] != 0) {
             double gg = kdmax1 * gradFunc[kpar];
             if (gg > 0)
                gg = std::min(gg, kdmax2);
             else
                gg = std::max(gg, -kdmax2);
-            pointContribution[kpar] = -gg;
+            res[kpar] += -gg;
          }
          // if func derivative is zero term is also zero so do not add in g[kpar]
       }
-
-      return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
+   auto rangeFunction = [&](unsigned int begin, unsigned int end, double *res) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> xc;
+      for (unsigned int i = begin; i < end; ++i)
+         pointFunction(i, gradFunc.data(), xc, res);
    };
 
    std::vector<double> g(npar);
@@ -1218,29 +1254,33 @@ void FitUtil::EvaluateLogLGradient(const IModelFunction &f, const UnBinData &dat
    }
 #endif
 
+   if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+      // the worker processes are forked by the first evaluation and run on their copy of this
+      // stack frame: point p to the parameters they receive
+      auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *res) {
+         p = in;
+         (const_cast<IGradModelFunction &>(func)).SetParameters(p);
+         rangeFunction(begin, end, res);
+      };
+      // on failure, the reason has been reported
+      if (!EvaluateInProcesses("LogLGradient", processPool, npar, initialNPoints, p, npar, evalRange, g.data()))
+         executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+   }
+
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      rangeFunction(0, initialNPoints, g.data());
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      ROOT::TThreadExecutor pool;
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = EvaluateRangesInParallel<double>(rangeFunction, initialNPoints, npar, chunks);
    }
 #endif
-
-   // else if(executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess){
-   //    ROOT::TProcessExecutor pool;
-   //    g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   // }
-   else {
+   else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
       Error("FitUtil::EvaluateLogLGradient", "Execution policy unknown. Avalaible choices:\n "
                                              "ROOT::Fit::ExecutionPolicy::kSerial (default)\n "
-                                             "ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n");
+                                             "ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n "
+                                             "ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
    }
 
 #ifndef R__USE_IMT
@@ -1370,7 +1410,7 @@ double FitUtil::EvaluatePoissonBinPdf(const IModelFunction & func, const BinData
 
 double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &data, const double *p, int iWeight,
                                     bool extended, unsigned int &nPoints, ROOT::Fit::ExecutionPolicy executionPolicy,
-                                    unsigned nChunks)
+                                    unsigned nChunks, ProcessPoolHandle *processPool)
 {
    // evaluate the Poisson Log Likelihood
    // for binned likelihood fits
@@ -1544,6 +1584,34 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 #endif
 
    double res{};
+   if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+      // the worker processes are forked by the first evaluation and run on their copy of this
+      // stack frame: point p to the parameters they receive, and update the state of this call
+      const unsigned int npar = func.NPar();
+      auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *r) {
+         p = in;
+         useW2 = (in[npar] != 0);
+         extended = (in[npar + 1] != 0);
+         (const_cast<IModelFunction &>(func)).SetParameters(p);
+         igEval.SetParameters(p);
+         nPoints = 0;
+         for (unsigned int i = begin; i < end; ++i)
+            r[0] += mapFunction(i);
+         r[1] += nPoints;
+      };
+      std::vector<double> in(p, p + npar);
+      in.push_back(useW2);
+      in.push_back(extended);
+      double resArray[2] = {0., 0.};
+      if (EvaluateInProcesses("PoissonLogL", processPool, in.size(), n, in.data(), 2, evalRange, resArray)) {
+         res = resArray[0];
+         nPoints = static_cast<unsigned int>(resArray[1]);
+      } else {
+         // the reason has been reported
+         executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+      }
+   }
+
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
       for (unsigned int i = 0; i < n; ++i) {
          res += mapFunction(i);
@@ -1554,12 +1622,9 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
       ROOT::TThreadExecutor pool;
       res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
 #endif
-      //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
-      // ROOT::TProcessExecutor pool;
-      // res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   } else {
+   } else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
       Error("FitUtil::EvaluatePoissonLogL",
-            "Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n");
+            "Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
    }
 
 #ifdef DEBUG
@@ -1570,7 +1635,8 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 }
 
 void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData &data, const double *p, double *grad,
-                                          unsigned int &, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks)
+                                          unsigned int &, ROOT::Fit::ExecutionPolicy executionPolicy, unsigned nChunks,
+                                          ProcessPoolHandle *processPool)
 {
    // evaluate the gradient of the Poisson log likelihood function
 
@@ -1596,11 +1662,12 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   auto mapFunction = [&](const unsigned int i) {
-      // set all vector values to zero
-      std::vector<double> gradFunc(npar);
-      std::vector<double> pointContribution(npar);
+   const double kdmax1 = std::sqrt(std::numeric_limits<double>::max());
+   const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
 
+   // add the contribution of the point i to the gradient in res; gradFunc and xc are buffers
+   // reused for all the points of a range
+   auto pointFunction = [&](const unsigned int i, double *gradFunc, std::vector<double> &xc, double *res) {
       const auto x1 = data.GetCoordComponent(i, 0);
       const auto y = data.Value(i);
       auto invError = data.Error(i);
@@ -1610,7 +1677,6 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
       double fval = 0;
 
       const double *x = nullptr;
-      std::vector<double> xc;
 
       unsigned ndim = data.NDim();
       double binVolume = 1.0;
@@ -1640,13 +1706,13 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
       if (!useBinIntegral) {
          fval = func(x, p);
-         func.ParameterGradient(x, p, &gradFunc[0]);
+         func.ParameterGradient(x, p, gradFunc);
       } else {
          // calculate integral (normalized by bin volume)
          // need to set function and parameters here in case loop is parallelized
          auto x2 = data.BinUpEdge(i);
          fval = igEval(x, x2);
-         CalculateGradientIntegral(func, x, x2, p, &gradFunc[0]);
+         CalculateGradientIntegral(func, x, x2, p, gradFunc);
       }
       if (useBinVolume)
          fval *= binVolume;
@@ -1671,33 +1737,23 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
          // df/dp * (1.  - y/f )
          if (fval > 0)
-            pointContribution[ipar] = gradFunc[ipar] * (1. - y / fval);
+            res[ipar] += gradFunc[ipar] * (1. - y / fval);
          else if (gradFunc[ipar] != 0) {
-            const double kdmax1 = std::sqrt(std::numeric_limits<double>::max());
-            const double kdmax2 = std::numeric_limits<double>::max() / (4 * initialNPoints);
             double gg = kdmax1 * gradFunc[ipar];
             if (gg > 0)
                gg = std::min(gg, kdmax2);
             else
                gg = std::max(gg, -kdmax2);
-            pointContribution[ipar] = -gg;
+            res[ipar] += -gg;
          }
       }
-
-
-      return pointContribution;
    };
 
-   // Vertically reduce the set of vectors by summing its equally-indexed components
-   auto redFunction = [&](const std::vector<std::vector<double>> &pointContributions) {
-      std::vector<double> result(npar);
-
-      for (auto const &pointContribution : pointContributions) {
-         for (unsigned int parameterIndex = 0; parameterIndex < npar; parameterIndex++)
-            result[parameterIndex] += pointContribution[parameterIndex];
-      }
-
-      return result;
+   auto rangeFunction = [&](unsigned int begin, unsigned int end, double *res) {
+      std::vector<double> gradFunc(npar);
+      std::vector<double> xc;
+      for (unsigned int i = begin; i < end; ++i)
+         pointFunction(i, gradFunc.data(), xc, res);
    };
 
    std::vector<double> g(npar);
@@ -1712,28 +1768,34 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
    }
 #endif
 
+   if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultiprocess) {
+      // the worker processes are forked by the first evaluation and run on their copy of this
+      // stack frame: point p to the parameters they receive
+      auto evalRange = [&](const double *in, unsigned int begin, unsigned int end, double *res) {
+         p = in;
+         (const_cast<IGradModelFunction &>(func)).SetParameters(p);
+         igEval.SetParameters(p);
+         rangeFunction(begin, end, res);
+      };
+      // on failure, the reason has been reported
+      if (!EvaluateInProcesses("PoissonLogLGradient", processPool, npar, initialNPoints, p, npar, evalRange,
+                               g.data()))
+         executionPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+   }
+
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
-      std::vector<std::vector<double>> allGradients(initialNPoints);
-      for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
-      }
-      g = redFunction(allGradients);
+      rangeFunction(0, initialNPoints, g.data());
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      ROOT::TThreadExecutor pool;
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = EvaluateRangesInParallel<double>(rangeFunction, initialNPoints, npar, chunks);
    }
 #endif
-
-   // else if(executionPolicy == ROOT::Fit::kMultiprocess){
-   //    ROOT::TProcessExecutor pool;
-   //    g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction);
-   // }
-   else {
+   else if (executionPolicy != ROOT::Fit::ExecutionPolicy::kMultiprocess) {
       Error("FitUtil::EvaluatePoissonLogLGradient",
-            "Execution policy unknown. Avalaible choices:\n 0: Serial (default)\n 1: MultiThread (requires IMT)\n");
+            "Execution policy unknown. Avalaible choices:\n ROOT::Fit::ExecutionPolicy::kSerial (default)\n "
+            "ROOT::Fit::ExecutionPolicy::kMultithread (requires IMT)\n ROOT::Fit::ExecutionPolicy::kMultiprocess\n");
    }
 
 #ifndef R__USE_IMT
@@ -276,7 +276,7 @@ int main()
       return -1;
    }
 
-#if defined(R__USE_IMT) || defined(R__HAS_VECCORE)
+#if defined(R__USE_IMT) || defined(R__HAS_VECCORE) || !defined(_WIN32)
    auto seq = test.GetFitter().Result().MinFcnValue();
 #endif
 
@@ -291,6 +291,24 @@ int main()
       return 1;
 #endif
 
+#ifndef _WIN32
+   //Multiprocess (the worker processes cannot be forked while implicit multi-threading is enabled)
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+   bool mpOk = test.testMPFit();
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(0);
+#endif
+   if (!mpOk) {
+      Error("testLogLExecPolicy", "Multiprocess Fit failed!");
+      return -1;
+   }
+   auto seqMP = test.GetFitter().Result().MinFcnValue();
+   if (!compareResult(seqMP, seq, "Multiprocess LogL Fit: "))
+      return 4;
+#endif
+
 #ifdef R__HAS_VECCORE
    //Vectorized
    if (!test.testFitVec()) {
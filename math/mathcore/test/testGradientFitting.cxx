@@ -282,7 +282,15 @@ TYPED_TEST_P(GradientFittingTest, Multithread)
    EXPECT_TRUE(TestFixture::RunFit(ROOT::Fit::ExecutionPolicy::kMultithread));
 }
 
-REGISTER_TYPED_TEST_CASE_P(GradientFittingTest,Sequential,Multithread);
+// The multi-process evaluation is only implemented for scalar model functions
+TYPED_TEST_P(GradientFittingTest, Multiprocess)
+{
+   if (!std::is_same<typename TypeParam::DataType, Double_t>::value)
+      return;
+   EXPECT_TRUE(TestFixture::RunFit(ROOT::Fit::ExecutionPolicy::kMultiprocess));
+}
+
+REGISTER_TYPED_TEST_CASE_P(GradientFittingTest,Sequential,Multithread,Multiprocess);
 
 INSTANTIATE_TYPED_TEST_CASE_P(GradientFitting, GradientFittingTest, TestTypes); 
 
@@ -467,6 +467,10 @@ bool Minuit2Minimizer::Minimize() {
       bool ret = minuit2Opt->GetValue("StorageLevel",storageLevel);
       if (ret) SetStorageLevel(storageLevel);
 
+      int parallelGradient = 0;
+      minuit2Opt->GetValue("ParallelGradient",parallelGradient);
+      strategy.SetParallelGradient(parallelGradient != 0);
+
       if (printLevel > 0) {
          std::cout << "Minuit2Minimizer::Minuit  - Changing default options" << std::endl;
          minuit2Opt->Print();
@@ -95,7 +95,9 @@ MnCross MnFunctionCross::operator()(const std::vector<unsigned int>& par, const
    if(aulim  < aopt+tla) limset = true;
 
 
-   MnMigrad migrad(fFCN, fState, MnStrategy(std::max(0, int(fStrategy.Strategy()-1))));
+   MnStrategy strategy(std::max(0, int(fStrategy.Strategy()-1)));
+   strategy.SetParallelGradient(fStrategy.ParallelGradient());
+   MnMigrad migrad(fFCN, fState, strategy);
 
    for(unsigned int i = 0; i < npar; i++) {
 #ifdef DEBUG
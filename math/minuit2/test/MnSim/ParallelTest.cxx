@@ -14,6 +14,8 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MnMigrad.h"
 #include "Minuit2/MnMinos.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnUserParameters.h"
 #include "Minuit2/MnPlot.h"
 #include "Minuit2/MinosError.h"
 #include "Minuit2/FCNBase.h"
@@ -27,6 +29,9 @@
 // The default number of dimension is 20 (fit in 40 parameters) on 1000 data events.
 // One can change the dimension and the number of events by doing:
 // ./test_Minuit2_Parallel    ndim  nevents
+// When ROOT is built with imt, passing 1 as third argument computes the
+// numerical gradient in parallel using the ROOT thread pool:
+// ./test_Minuit2_Parallel    ndim  nevents  1
 
 using namespace ROOT::Minuit2;
 
@@ -70,7 +75,7 @@ struct LogLikeFCN  : public FCNBase {
    const Data & fData;
 };
 
-int doFit(int ndim, int ndata) {
+int doFit(int ndim, int ndata, bool parallelGradient) {
 
   // generate the data (1000 data points) in 100 dimension
 
@@ -110,8 +115,11 @@ int doFit(int ndim, int ndata) {
   // create minimizer (default constructor)
   VariableMetricMinimizer fMinimizer;
 
+  MnStrategy strategy(1);
+  strategy.SetParallelGradient(parallelGradient);
+
   // Minimize
-  FunctionMinimum min = fMinimizer.Minimize(fcn, init_par, init_err);
+  FunctionMinimum min = fMinimizer.Minimize(fcn, MnUserParameters(init_par, init_err), strategy);
 
   // output
   std::cout<<"minimum: "<<min<<std::endl;
@@ -147,12 +155,16 @@ int doFit(int ndim, int ndata) {
 int main(int argc, char **argv) {
    int ndim = default_ndim;
    int ndata = default_ndata;
+   bool parallelGradient = false;
    if (argc > 1) {
       ndim = atoi(argv[1] );
    }
    if (argc > 2) {
       ndata = atoi(argv[2] );
    }
+   if (argc > 3) {
+      parallelGradient = atoi(argv[3] ) != 0;
+   }
    std::cout << "do fit of " << ndim << " dimensional data on " << ndata << " events " << std::endl;
-   doFit(ndim,ndata);
+   doFit(ndim,ndata,parallelGradient);
 }
@@ -39,6 +39,7 @@ protected:
   RooRealProxy c;
 
   Double_t evaluate() const;
+  Bool_t evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const;
 
 private:
   ClassDef(RooExponential,1) // Exponential PDF
@@ -46,6 +46,7 @@ protected:
   RooRealProxy sigma ;
 
   Double_t evaluate() const ;
+  Bool_t evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const ;
 
 private:
 
@@ -25,6 +25,7 @@ Exponential p.d.f
 #include "Riostream.h"
 #include "Riostream.h"
 #include <math.h>
+#include <vector>
 
 #include "RooExponential.h"
 #include "RooRealVar.h"
@@ -57,6 +58,23 @@ Double_t RooExponential::evaluate() const{
   return exp(c*x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the values of the exponential for a range of events, see RooAbsReal::getValBatch()
+
+Bool_t RooExponential::evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const
+{
+  std::vector<Double_t> cVal(n);
+  if (!x.arg().getValBatch(output,data,begin,n,x.nset()) ||
+      !c.arg().getValBatch(cVal.data(),data,begin,n,c.nset())) {
+    return kFALSE;
+  }
+
+  for (Int_t i=0; i<n; i++) {
+    output[i] = exp(cVal[i]*output[i]);
+  }
+  return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooExponential::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -25,6 +25,7 @@ Plain Gaussian p.d.f
 #include "Riostream.h"
 #include "Riostream.h"
 #include <math.h>
+#include <vector>
 
 #include "RooGaussian.h"
 #include "RooAbsReal.h"
@@ -69,6 +70,26 @@ Double_t RooGaussian::evaluate() const
   return ret ;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the values of the Gaussian for a range of events, see RooAbsReal::getValBatch()
+
+Bool_t RooGaussian::evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const
+{
+  std::vector<Double_t> meanVal(n), sigmaVal(n) ;
+  if (!x.arg().getValBatch(output,data,begin,n,x.nset()) ||
+      !mean.arg().getValBatch(meanVal.data(),data,begin,n,mean.nset()) ||
+      !sigma.arg().getValBatch(sigmaVal.data(),data,begin,n,sigma.nset())) {
+    return kFALSE ;
+  }
+
+  for (Int_t i=0 ; i<n ; i++) {
+    Double_t arg = output[i] - meanVal[i] ;
+    Double_t sig = sigmaVal[i] ;
+    output[i] = exp(-0.5*arg*arg/(sig*sig)) ;
+  }
+  return kTRUE ;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// calculate and return the negative log-likelihood of the Poisson
 
@@ -26,10 +26,12 @@ less than polynomial functions due to the normalization condition
 
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 
 #include "RooPolynomial.h"
 #include "RooAbsReal.h"
 #include "RooArgList.h"
+#include "RooAbsDataStore.h"
 #include "RooMsgService.h"
 
 #include "TError.h"
@@ -123,6 +125,43 @@ Double_t RooPolynomial::evaluate() const
   return retVal * std::pow(x, lowestOrder) + (lowestOrder ? 1.0 : 0.0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the values of the polynomial for a range of events, see
+/// RooAbsReal::getValBatch(). The Horner scheme of evaluate() is applied to
+/// all events at once, which requires coefficients that do not depend on the
+/// observables of the data.
+
+Bool_t RooPolynomial::evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const
+{
+  const unsigned sz = _coefList.getSize();
+  const int lowestOrder = _lowestOrder;
+  if (!sz) {
+    std::fill(output, output + n, lowestOrder ? 1. : 0.);
+    return kTRUE;
+  }
+  _wksp.clear();
+  _wksp.reserve(sz);
+  {
+    const RooArgSet* nset = _coefList.nset();
+    RooFIter it = _coefList.fwdIterator();
+    RooAbsReal* c;
+    while ((c = (RooAbsReal*) it.next())) {
+      if (c->dependsOnValue(*data.get())) return kFALSE;
+      _wksp.push_back(c->getVal(nset));
+    }
+  }
+  std::vector<Double_t> x(n);
+  if (!_x.arg().getValBatch(x.data(), data, begin, n, _x.nset())) return kFALSE;
+
+  std::fill(output, output + n, _wksp[sz - 1]);
+  for (unsigned j = sz - 1; j--; ) {
+    const Double_t coef = _wksp[j];
+    for (Int_t i = 0; i < n; ++i) output[i] = coef + x[i] * output[i];
+  }
+  for (Int_t i = 0; i < n; ++i) output[i] = output[i] * std::pow(x[i], lowestOrder) + (lowestOrder ? 1.0 : 0.0);
+  return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooPolynomial::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -24,6 +24,7 @@
 
 
 class RooAbsArg ;
+class RooAbsReal ;
 class RooArgList ;
 class TIterator ;
 class TTree ;
@@ -54,6 +55,9 @@ public:
 
   virtual Bool_t isWeighted() const = 0 ;
 
+  // Direct access to the stored values of a real-valued column for a range of events
+  virtual const Double_t* getBatch(const RooAbsReal& /*real*/, Int_t /*begin*/, Int_t /*n*/) const { return 0 ; }
+
   // Change observable name
   virtual Bool_t changeObservableName(const char* from, const char* to) =0 ;
   
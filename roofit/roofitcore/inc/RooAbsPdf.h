@@ -186,6 +186,7 @@ public:
   virtual Bool_t traceEvalHook(Double_t value) const ;  
   virtual Double_t getValV(const RooArgSet* set=0) const ;
   virtual Double_t getLogVal(const RooArgSet* set=0) const ;
+  virtual Bool_t getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* set=0) const ;
 
   Double_t getNorm(const RooArgSet& nset) const { 
     // Get p.d.f normalization term needed for observables 'nset'
@@ -295,6 +296,7 @@ protected:
   static Int_t _verboseEval ;
 
   virtual Bool_t syncNormalization(const RooArgSet* dset, Bool_t adjustProxies=kTRUE) const ;
+  Bool_t checkBatch(const Double_t* values, Int_t n) const ;
 
   friend class RooAbsAnaConvPdf ;
   mutable Double_t _rawValue ;
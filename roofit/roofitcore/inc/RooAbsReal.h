@@ -40,6 +40,7 @@ class RooFitResult ;
 class RooAbsMoment ;
 class RooDerivative ;
 class RooVectorDataStore ;
+class RooAbsDataStore ;
 
 class TH1;
 class TH1F;
@@ -73,6 +74,9 @@ public:
 
   virtual Double_t getValV(const RooArgSet* set=0) const ;
 
+  // Evaluation for a range of events of a data store
+  virtual Bool_t getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* set=0) const ;
+
   Double_t getPropagatedError(const RooFitResult &fr, const RooArgSet &nset = RooArgSet());
 
   Bool_t operator==(Double_t value) const ;
@@ -371,6 +375,10 @@ protected:
     return kFALSE ;
   }
   virtual Double_t evaluate() const = 0 ;
+  virtual Bool_t evaluateBatch(Double_t* /*output*/, const RooAbsDataStore& /*data*/, Int_t /*begin*/, Int_t /*n*/) const {
+    // Hook for derived classes evaluating evaluate() for a range of events at once
+    return kFALSE ;
+  }
 
   // Hooks for RooDataSet interface
   friend class RooRealIntegral ;
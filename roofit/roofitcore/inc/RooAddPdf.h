@@ -122,6 +122,8 @@ protected:
   CacheElem* getProjCache(const RooArgSet* nset, const RooArgSet* iset=0, const char* rangeName=0) const ;
   void updateCoefficients(CacheElem& cache, const RooArgSet* nset) const ;
 
+  Bool_t evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const ;
+
   
   friend class RooAddGenContext ;
   virtual RooAbsGenContext* genContext(const RooArgSet &vars, const RooDataSet *prototype=0, 
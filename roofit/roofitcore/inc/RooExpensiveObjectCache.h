@@ -40,6 +40,15 @@ public:
 
   void importCacheObjects(RooExpensiveObjectCache& other, const char* ownerName, Bool_t verbose=kFALSE) ;
 
+  Bool_t registerValue(const char* name, Double_t value, const RooArgSet& params) ;
+  Bool_t retrieveValue(const char* name, const RooArgSet& params, Double_t& value) const ;
+  void setMaxValues(Int_t maxValues) ;
+  Int_t maxValues() const ;
+  Int_t numValues() const ;
+  void clearValues() ;
+  Bool_t writeValues(const char* fileName) const ;
+  Bool_t readValues(const char* fileName) ;
+
   static RooExpensiveObjectCache& instance() ;
 
   Int_t size() const { return _map.size() ; }
@@ -78,14 +87,19 @@ public:
  
 protected:
 
+  static TString valueKey(const char* name, const RooArgSet& params) ;
+
   Int_t _nextUID ; 
 
   static RooExpensiveObjectCache* _instance ;  //!
 
   std::map<TString,ExpensiveObject*> _map ;
+
+  Int_t _maxValues ; // Maximum number of cached values, zero disables the value cache
+  std::map<TString,Double_t> _valueMap ; // Cached values indexed by name and exact parameter values
  
   
-  ClassDef(RooExpensiveObjectCache,2) // Singleton class that serves as session repository for expensive objects
+  ClassDef(RooExpensiveObjectCache,3) // Singleton class that serves as session repository for expensive objects
 };
 
 #endif
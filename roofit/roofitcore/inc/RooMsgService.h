@@ -22,6 +22,7 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <atomic>
 #include "RooCmdArg.h"
 #include "RooGlobalFunc.h"
 class RooAbsArg ;
@@ -198,12 +199,12 @@ protected:
 
   std::map<std::string,std::ostream*> _files ;
   RooFit::MsgLevel _globMinLevel ;
-  RooFit::MsgLevel _lastMsgLevel ;
+  std::atomic<RooFit::MsgLevel> _lastMsgLevel ; //! Level of the last message (messages can be logged from several threads)
 
   Bool_t _silentMode ; 
   Bool_t _showPid ;
 
-  Int_t _errorCount ;  
+  std::atomic<Int_t> _errorCount ; //! Number of error messages (messages can be logged from several threads)
 
   // Private ctor -- singleton class
   RooMsgService() ;
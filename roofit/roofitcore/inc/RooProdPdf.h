@@ -54,6 +54,7 @@ public:
   virtual ~RooProdPdf() ;
 
   virtual Double_t getValV(const RooArgSet* set=0) const ;
+  virtual Bool_t getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* set=0) const ;
   Double_t evaluate() const ;
   virtual Bool_t checkObservables(const RooArgSet* nset) const ;	
 
@@ -153,6 +154,7 @@ protected:
   RooAbsReal* specializeRatio(RooFormulaVar& input, const char* targetRangeName) const ;
   Double_t calculate(const RooProdPdf::CacheElem& cache, Bool_t verbose=kFALSE) const ;
   Double_t calculate(const RooArgList* partIntList, const RooLinkedList* normSetList) const ;
+  Bool_t evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const ;
 
  
   friend class RooProdGenContext ;
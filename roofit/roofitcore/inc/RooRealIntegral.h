@@ -134,6 +134,9 @@ protected:
   
   mutable RooArgSet* _params ; //! cache for set of parameters
 
+  TString valueCacheKey() const ;
+  mutable TString _valueCacheKey ; //! name of integral in value cache, including integrand structure but not the limits
+
   Bool_t _cacheNum ;           // Cache integral if numeric
   static Int_t _cacheAllNDim ; //! Cache all integrals with given numeric dimension
 
@@ -75,6 +75,8 @@ public:
   virtual Double_t weight(Int_t index) const ;
   virtual Bool_t isWeighted() const { return (_wgtVar!=0||_extWgtArray!=0) ; }
 
+  virtual const Double_t* getBatch(const RooAbsReal& real, Int_t begin, Int_t n) const ;
+
   // Change observable name
   virtual Bool_t changeObservableName(const char* from, const char* to) ;
   
@@ -126,6 +126,7 @@ the proxy holds a function, and will trigger an assert
 #include "TMatrixDSym.h"
 #include "RooAbsPdf.h"
 #include "RooDataSet.h"
+#include "RooAbsDataStore.h"
 #include "RooArgSet.h"
 #include "RooArgProxy.h"
 #include "RooRealProxy.h"
@@ -312,6 +313,72 @@ Double_t RooAbsPdf::getValV(const RooArgSet* nset) const
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the normalized values of this p.d.f. for the 'n' events of data
+/// store 'data' starting at event 'begin' (see RooAbsReal::getValBatch()).
+/// The values returned by evaluateBatch() are divided by the normalization
+/// integral, which is calculated once for all events.
+///
+/// If the normalization depends on the observables of the data, as for
+/// conditional p.d.f.s, or if the normalization or any of the unnormalized
+/// values is negative or not a number, kFALSE is returned: the events are
+/// then to be evaluated with getVal(), which reports the evaluation errors.
+
+Bool_t RooAbsPdf::getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* nset) const
+{
+  // Stored values and p.d.f.s not depending on the data need no normalization here
+  if (data.getBatch(*this,begin,n) || !dependsOnValue(*data.get())) {
+    return RooAbsReal::getValBatch(output,data,begin,n,nset) ;
+  }
+
+  // Special handling of case without normalization set, as in getValV()
+  if (!nset) {
+    RooArgSet* tmp = _normSet ;
+    _normSet = 0 ;
+    Bool_t ok = evaluateBatch(output,data,begin,n) ;
+    _normSet = tmp ;
+    return ok && checkBatch(output,n) ;
+  }
+
+  if (nset!=_normSet || _norm==0) {
+    syncNormalization(nset) ;
+  }
+  if (_norm->dependsOnValue(*data.get())) {
+    return kFALSE ;
+  }
+
+  Double_t normVal(_norm->getVal()) ;
+  if (!(normVal>0.)) {
+    return kFALSE ;
+  }
+
+  if (!evaluateBatch(output,data,begin,n) || !checkBatch(output,n)) {
+    return kFALSE ;
+  }
+  for (Int_t i=0 ; i<n ; i++) {
+    output[i] /= normVal ;
+  }
+
+  return kTRUE ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if none of the 'n' unnormalized p.d.f. values in 'values' is
+/// negative or not a number, i.e. if traceEvalPdf() would not flag any of them
+
+Bool_t RooAbsPdf::checkBatch(const Double_t* values, Int_t n) const
+{
+  Bool_t valid(kTRUE) ;
+  for (Int_t i=0 ; i<n ; i++) {
+    valid &= (values[i]>=0.) ;
+  }
+  return valid ;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Analytical integral with normalization (see RooAbsReal::analyticalIntegralWN() for further information)
 ///
@@ -735,6 +802,9 @@ Double_t RooAbsPdf::extendedTerm(Double_t observed, const RooArgSet* nset) const
 ///                                    Strategy 3 = RooFit::Hybrid --> Follow strategy 0 for all RooSimultaneous components, except those with less than
 ///                                                 30 dataset entries, for which strategy 2 is followed.
 ///
+/// NumThreads(int num)             -- Share the NLL calculation between num threads of the ROOT thread pool. Each thread
+///                                    evaluates its events with a private copy of the p.d.f. and of the dataset
+///
 /// Optimize(Bool_t flag)           -- Activate constant term optimization (on by default)
 /// SplitRange(Bool_t flag)         -- Use separate fit ranges in a simultaneous fit. Actual range name for each
 ///                                    subsample is assumed to by rangeName_{indexState} where indexState
@@ -790,6 +860,7 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
   pc.defineInt("ext","Extended",0,2) ;
   pc.defineInt("numcpu","NumCPU",0,1) ;
   pc.defineInt("interleave","NumCPU",1,0) ;
+  pc.defineInt("numthreads","NumThreads",0,1) ;
   pc.defineInt("verbose","Verbose",0,0) ;
   pc.defineInt("optConst","Optimize",0,0) ;
   pc.defineInt("cloneData","CloneData",2,0) ;
@@ -816,6 +887,7 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
   Int_t ext      = pc.getInt("ext") ;
   Int_t numcpu   = pc.getInt("numcpu") ;
   RooFit::MPSplit interl = (RooFit::MPSplit) pc.getInt("interleave") ;
+  Int_t numthreads = pc.getInt("numthreads") ;
 
   Int_t splitr   = pc.getInt("splitRange") ;
   Bool_t verbose = pc.getInt("verbose") ;
@@ -900,7 +972,11 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
     // Simple case: default range, or single restricted range
     //cout<<"FK: Data test 1: "<<data.sumEntries()<<endl;
 
-    nll = new RooNLLVar(baseName.c_str(),"-log(likelihood)",*this,data,projDeps,ext,rangeName,addCoefRangeName,numcpu,interl,verbose,splitr,cloneData) ;
+    RooNLLVar* nllVar = new RooNLLVar(baseName.c_str(),"-log(likelihood)",*this,data,projDeps,ext,rangeName,addCoefRangeName,numcpu,interl,verbose,splitr,cloneData) ;
+    if (numthreads>1) {
+      nllVar->setNumThreads(numthreads) ;
+    }
+    nll = nllVar ;
 
   } else {
     // Composite case: multiple ranges
@@ -910,7 +986,10 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
     strlcpy(buf,rangeName,bufSize) ;
     char* token = strtok(buf,",") ;
     while(token) {
-      RooAbsReal* nllComp = new RooNLLVar(Form("%s_%s",baseName.c_str(),token),"-log(likelihood)",*this,data,projDeps,ext,token,addCoefRangeName,numcpu,interl,verbose,splitr,cloneData) ;
+      RooNLLVar* nllComp = new RooNLLVar(Form("%s_%s",baseName.c_str(),token),"-log(likelihood)",*this,data,projDeps,ext,token,addCoefRangeName,numcpu,interl,verbose,splitr,cloneData) ;
+      if (numthreads>1) {
+	nllComp->setNumThreads(numthreads) ;
+      }
       nllList.add(*nllComp) ;
       token = strtok(0,",") ;
     }
@@ -1020,6 +1099,9 @@ RooAbsReal* RooAbsPdf::createNLL(RooAbsData& data, const RooLinkedList& cmdList)
 ///                                    Strategy 3 = RooFit::Hybrid --> Follow strategy 0 for all RooSimultaneous components, except those with less than
 ///                                                 30 dataset entries, for which strategy 2 is followed.
 ///
+/// NumThreads(int num)             -- Share the NLL calculation between num threads of the ROOT thread pool. Each thread
+///                                    evaluates its events with a private copy of the p.d.f. and of the dataset
+///
 /// SplitRange(Bool_t flag)         -- Use separate fit ranges in a simultaneous fit. Actual range name for each
 ///                                    subsample is assumed to by rangeName_{indexState} where indexState
 ///                                    is the state of the master index category of the simultaneous fit
@@ -1106,7 +1188,7 @@ RooFitResult* RooAbsPdf::fitTo(RooAbsData& data, const RooLinkedList& cmdList)
   RooCmdConfig pc(Form("RooAbsPdf::fitTo(%s)",GetName())) ;
 
   RooLinkedList fitCmdList(cmdList) ;
-  RooLinkedList nllCmdList = pc.filterCmdList(fitCmdList,"ProjectedObservables,Extended,Range,RangeWithName,SumCoefRange,NumCPU,SplitRange,Constrained,Constrain,ExternalConstraints,CloneData,GlobalObservables,GlobalObservablesTag,OffsetLikelihood") ;
+  RooLinkedList nllCmdList = pc.filterCmdList(fitCmdList,"ProjectedObservables,Extended,Range,RangeWithName,SumCoefRange,NumCPU,NumThreads,SplitRange,Constrained,Constrain,ExternalConstraints,CloneData,GlobalObservables,GlobalObservablesTag,OffsetLikelihood") ;
 
   pc.defineString("fitOpt","FitOptions",0,"") ;
   pc.defineInt("optConst","Optimize",0,2) ;
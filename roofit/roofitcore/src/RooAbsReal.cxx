@@ -103,6 +103,8 @@
 #include "TVector.h"
 
 #include <sstream>
+#include <algorithm>
+#include <mutex>
 
 using namespace std ;
 
@@ -120,6 +122,10 @@ RooAbsReal::ErrorLoggingMode RooAbsReal::_evalErrorMode = RooAbsReal::PrintError
 Int_t RooAbsReal::_evalErrorCount = 0 ;
 map<const RooAbsArg*,pair<string,list<RooAbsReal::EvalError> > > RooAbsReal::_evalErrorList ;
 
+// Protects the evaluation error log, as errors can be logged concurrently by
+// test statistics evaluated in multiple threads
+static std::mutex _evalErrorMutex ;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// coverity[UNINIT_CTOR]
@@ -264,6 +270,43 @@ Double_t RooAbsReal::getValV(const RooArgSet* nset) const
 }
 
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the values of this function for the 'n' events of data store
+/// 'data' starting at event 'begin' and write them in 'output', without
+/// loading the events in the observables. Values stored in the data, as an
+/// observable or as a node cached by the constant term optimization, are
+/// copied directly, and a function that does not depend on the observables
+/// of the data is evaluated once. Otherwise the calculation is delegated to
+/// evaluateBatch(), which is implemented by the classes that provide a
+/// vectorized version of evaluate().
+///
+/// No error checking is performed on the returned values. If kFALSE is
+/// returned the values could not be calculated this way and the events must
+/// be evaluated one by one with getVal().
+
+Bool_t RooAbsReal::getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* nset) const
+{
+  const Double_t* column = data.getBatch(*this,begin,n) ;
+  if (column) {
+    std::copy(column,column+n,output) ;
+    return kTRUE ;
+  }
+
+  if (!dependsOnValue(*data.get())) {
+    std::fill(output,output+n,getVal(nset)) ;
+    return kTRUE ;
+  }
+
+  if (nset && nset!=_lastNSet) {
+    ((RooAbsReal*) this)->setProxyNormSet(nset) ;
+    _lastNSet = (RooArgSet*) nset ;
+  }
+
+  return evaluateBatch(output,data,begin,n) ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooAbsReal::numEvalErrorItems()
@@ -3601,16 +3644,20 @@ void RooAbsReal::logEvalError(const RooAbsReal* originator, const char* origName
     return ;
   }
 
-  if (_evalErrorMode==CountErrors) {
-    _evalErrorCount++ ;
+  // The recursion guard is per thread, the log itself is shared
+  static thread_local Bool_t inLogEvalError = kFALSE ;
+
+  if (inLogEvalError) {
     return ;
   }
 
-  static Bool_t inLogEvalError = kFALSE ;
+  std::lock_guard<std::mutex> lock(_evalErrorMutex) ;
 
-  if (inLogEvalError) {
+  if (_evalErrorMode==CountErrors) {
+    _evalErrorCount++ ;
     return ;
   }
+
   inLogEvalError = kTRUE ;
 
   EvalError ee ;
@@ -3656,16 +3703,20 @@ void RooAbsReal::logEvalError(const char* message, const char* serverValueString
     return ;
   }
 
-  if (_evalErrorMode==CountErrors) {
-    _evalErrorCount++ ;
+  // The recursion guard is per thread, the log itself is shared
+  static thread_local Bool_t inLogEvalError = kFALSE ;
+
+  if (inLogEvalError) {
     return ;
   }
 
-  static Bool_t inLogEvalError = kFALSE ;
+  std::lock_guard<std::mutex> lock(_evalErrorMutex) ;
 
-  if (inLogEvalError) {
+  if (_evalErrorMode==CountErrors) {
+    _evalErrorCount++ ;
     return ;
   }
+
   inLogEvalError = kTRUE ;
 
   EvalError ee ;
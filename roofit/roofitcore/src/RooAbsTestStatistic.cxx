@@ -32,6 +32,13 @@ organizes multi-processor parallel calculation of test statistic
 values. For the latter, the test statistic value is calculated in
 partitions in parallel executing processes and a posteriori
 combined in the main thread.
+
+Alternatively, the partition of a test statistic instance can be shared
+between threads (see setNumThreads()). Each additional thread evaluates
+its events with its own clone of the test statistic, i.e. of the input
+function and of the dataset, while the parameters are shared by all
+clones. The partial results are combined in a fixed order, so that the
+result does not depend on the scheduling of the threads.
 **/
 
 
@@ -48,10 +55,17 @@ combined in the main thread.
 #include "RooRealMPFE.h"
 #include "RooErrorHandler.h"
 #include "RooMsgService.h"
+#include "RooNumIntConfig.h"
 #include "TTimeStamp.h"
 #include "RooProdPdf.h"
 #include "RooRealSumPdf.h"
 #include <string>
+#include <vector>
+#include <algorithm>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 using namespace std;
 
@@ -64,7 +78,7 @@ RooAbsTestStatistic::RooAbsTestStatistic() :
   _func(0), _data(0), _projDeps(0), _splitRange(0), _simCount(0),
   _verbose(kFALSE), _init(kFALSE), _gofOpMode(Slave), _nEvents(0), _setNum(0),
   _numSets(0), _extSet(0), _nGof(0), _gofArray(0), _nCPU(1), _mpfeArray(0),
-  _mpinterl(RooFit::BulkPartition), _doOffset(kFALSE), _offset(0),
+  _nThreads(1), _mtGofArray(0), _mtSerial(kTRUE), _mpinterl(RooFit::BulkPartition), _doOffset(kFALSE), _offset(0),
   _offsetCarry(0), _evalCarry(0)
 {
 }
@@ -102,6 +116,9 @@ RooAbsTestStatistic::RooAbsTestStatistic(const char *name, const char *title, Ro
   _gofArray(0),
   _nCPU(nCPU),
   _mpfeArray(0),
+  _nThreads(1),
+  _mtGofArray(0),
+  _mtSerial(kTRUE),
   _mpinterl(interleave),
   _doOffset(kFALSE),
   _offset(0),
@@ -161,6 +178,9 @@ RooAbsTestStatistic::RooAbsTestStatistic(const RooAbsTestStatistic& other, const
   _gofSplitMode(other._gofSplitMode),
   _nCPU(other._nCPU),
   _mpfeArray(0),
+  _nThreads(other._nThreads),
+  _mtGofArray(0),
+  _mtSerial(kTRUE),
   _mpinterl(other._mpinterl),
   _doOffset(other._doOffset),
   _offset(other._offset),
@@ -216,6 +236,8 @@ RooAbsTestStatistic::~RooAbsTestStatistic()
     delete[] _gofArray ;
   }
 
+  clearMTMode() ;
+
   delete _projDeps ;
 
 }
@@ -228,6 +250,8 @@ RooAbsTestStatistic::~RooAbsTestStatistic()
 /// is performed separately on each simultaneous p.d.f component and associated
 /// data and then combined. If the test statistic calculation is parallelized
 /// partitions are calculated in nCPU processes and a posteriori combined.
+/// If multiple threads are used, the partition of this instance is further
+/// split over the threads, see evaluatePartitionMT().
 
 Double_t RooAbsTestStatistic::evaluate() const
 {
@@ -316,7 +340,7 @@ Double_t RooAbsTestStatistic::evaluate() const
       break ;
     }
 
-    Double_t ret = evaluatePartition(nFirst,nLast,nStep);
+    Double_t ret = _mtGofArray ? evaluatePartitionMT(nFirst,nLast,nStep) : evaluatePartition(nFirst,nLast,nStep);
 
     if (numSets()==1) {
       const Double_t norm = globalNormalization();
@@ -344,6 +368,8 @@ Bool_t RooAbsTestStatistic::initialize()
     initMPMode(_func,_data,_projDeps,_rangeName.size()?_rangeName.c_str():0,_addCoefRangeName.size()?_addCoefRangeName.c_str():0) ;
   } else if (SimMaster == _gofOpMode) {
     initSimMode((RooSimultaneous*)_func,_data,_projDeps,_rangeName.size()?_rangeName.c_str():0,_addCoefRangeName.size()?_addCoefRangeName.c_str():0) ;
+  } else if (_nThreads>1) {
+    initMTMode() ;
   }
   _init = kTRUE;
   return kFALSE;
@@ -371,6 +397,11 @@ Bool_t RooAbsTestStatistic::redirectServersHook(const RooAbsCollection& newServe
 // 	cout << "redirecting servers on " << _mpfeArray[i]->GetName() << endl;
       }
     }
+  } else if (Slave == _gofOpMode && _mtGofArray) {
+    // Forward to thread clones
+    for (Int_t i = 0; i < _nThreads - 1; ++i) {
+      _mtGofArray[i]->recursiveRedirectServers(newServerList,mustReplaceAll,nameChange);
+    }
   }
   return kFALSE;
 }
@@ -421,6 +452,12 @@ void RooAbsTestStatistic::constOptimizeTestStatistic(ConstOpCode opcode, Bool_t
     for (Int_t i = 0; i < _nCPU; ++i) {
       _mpfeArray[i]->constOptimizeTestStatistic(opcode,doAlsoTrackingOpt);
     }
+  } else if (_mtGofArray) {
+    for (Int_t i = 0; i < _nThreads - 1; ++i) {
+      _mtGofArray[i]->constOptimizeTestStatistic(opcode,doAlsoTrackingOpt);
+    }
+    // The caches of the clones are (re)created at the next evaluation
+    _mtSerial = kTRUE ;
   }
 }
 
@@ -478,6 +515,143 @@ void RooAbsTestStatistic::initMPMode(RooAbsReal* real, RooAbsData* data, const R
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Share the evaluation of the test statistic between nThreads threads of the
+/// ROOT thread pool (see ROOT::EnableImplicitMT()). The events of the partition
+/// of this instance are split in nThreads blocks of consecutive events (or of
+/// interleaved events in Interleave mode). The first block is evaluated by this
+/// instance, the others by clones of this instance that each own a copy of the
+/// input function and of the dataset. The parameters are shared by all clones.
+/// The partial results are combined with Kahan summation in a fixed order.
+///
+/// In simultaneous mode the setting is forwarded to the component test statistics.
+/// It is ignored in multi-processor mode. Without imt support, the blocks are
+/// evaluated sequentially.
+
+void RooAbsTestStatistic::setNumThreads(Int_t nThreads)
+{
+  if (nThreads<1) {
+    nThreads = 1 ;
+  }
+
+  switch(operMode()) {
+  case Slave:
+    clearMTMode() ;
+    _nThreads = nThreads ;
+    if (_init && _nThreads>1) {
+      initMTMode() ;
+    }
+    setValueDirty() ;
+    break ;
+  case SimMaster:
+    _nThreads = nThreads ;
+    for (Int_t i = 0; _init && i < _nGof; ++i) {
+      _gofArray[i]->setNumThreads(nThreads);
+    }
+    break ;
+  case MPMaster:
+    if (nThreads>1) {
+      coutW(InputArguments) << "RooAbsTestStatistic::setNumThreads(" << GetName() << ") WARNING: multi-threaded evaluation "
+			    << "is not supported in multi-processor mode, ignoring request for " << nThreads << " threads" << endl ;
+    }
+    break ;
+  }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Initialize multi-threaded calculation mode. Create the clones of this test
+/// statistic that evaluate the sub-partitions of the other threads.
+
+void RooAbsTestStatistic::initMTMode()
+{
+  // The integrator factory and the default integrator configuration are created
+  // on first use, which is not thread-safe: make sure they exist before the
+  // clones are evaluated in the worker threads
+  RooNumIntConfig::defaultConfig();
+
+  _mtGofArray = new pRooAbsTestStatistic[_nThreads - 1];
+  for (Int_t i = 0; i < _nThreads - 1; ++i) {
+    RooAbsTestStatistic* gof = (RooAbsTestStatistic*) clone(Form("%s_MT%d",GetName(),i + 1));
+    gof->_nThreads = 1;
+    gof->_simCount = _simCount;
+    // Only this instance adds the extended term
+    gof->_extSet = -1;
+    // Clones evaluate fewer events than this instance used to, recalculate the offsets
+    gof->_offset = 0;
+    gof->_offsetCarry = 0;
+    _mtGofArray[i] = gof;
+  }
+  _offset = 0;
+  _offsetCarry = 0;
+  _mtSerial = kTRUE;
+  coutI(Eval) << "RooAbsTestStatistic::initMTMode(" << GetName() << ") sharing the evaluation between " << _nThreads << " threads" << endl;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the clones used in multi-threaded calculation mode
+
+void RooAbsTestStatistic::clearMTMode()
+{
+  if (!_mtGofArray) return;
+  for (Int_t i = 0; i < _nThreads - 1; ++i) delete _mtGofArray[i];
+  delete[] _mtGofArray;
+  _mtGofArray = 0;
+  _offset = 0;
+  _offsetCarry = 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the events [firstEvent,lastEvent) with step stepSize in _nThreads
+/// blocks, the first one by this instance and the others by the clones in
+/// _mtGofArray. The blocks are evaluated sequentially at the first call after
+/// the clones were created or re-optimized, so that the (not thread-safe)
+/// creation of their caches is not done concurrently.
+
+Double_t RooAbsTestStatistic::evaluatePartitionMT(Int_t firstEvent, Int_t lastEvent, Int_t stepSize) const
+{
+  const Int_t nSteps = lastEvent>firstEvent ? (lastEvent - firstEvent + stepSize - 1) / stepSize : 0;
+  std::vector<Double_t> values(_nThreads), carries(_nThreads);
+
+  auto evalBlock = [&](UInt_t i) {
+    const RooAbsTestStatistic* gof = (i == 0) ? this : _mtGofArray[i - 1];
+    const Int_t first = firstEvent + stepSize * Int_t((Long64_t)nSteps * i / _nThreads);
+    const Int_t last = firstEvent + stepSize * Int_t((Long64_t)nSteps * (i + 1) / _nThreads);
+    values[i] = gof->evaluatePartition(first, std::min(last, lastEvent), stepSize);
+    carries[i] = gof->getCarry();
+  };
+
+#ifdef R__USE_IMT
+  if (!_mtSerial) {
+    ROOT::TThreadExecutor pool;
+    pool.Foreach(evalBlock, ROOT::TSeq<UInt_t>(0, _nThreads));
+  } else
+#endif
+  {
+    for (Int_t i = 0; i < _nThreads; ++i) evalBlock(i);
+  }
+  _mtSerial = kFALSE;
+
+  Double_t sum(0), carry(0);
+  for (Int_t i = 0; i < _nThreads; ++i) {
+    Double_t y = values[i];
+    carry += carries[i];
+    y -= carry;
+    const Double_t t = sum + y;
+    carry = (t - sum) - y;
+    sum = t;
+  }
+  _evalCarry = carry;
+  return sum;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize simultaneous p.d.f processing mode. Strip simultaneous
 /// p.d.f into individual components, split dataset in subset
@@ -563,6 +737,9 @@ void RooAbsTestStatistic::initSimMode(RooSimultaneous* simpdf, RooAbsData* data,
 			      rangeName,addCoefRangeName,_nCPU,_mpinterl,_verbose,_splitRange,binnedL);
       }
       _gofArray[n]->setSimCount(_nGof);
+      if (_nThreads>1) {
+	_gofArray[n]->setNumThreads(_nThreads);
+      }
       // *** END HERE
 
       // Fill per-component split mode with Bulk Partition for now so that Auto will map to bulk-splitting of all components
@@ -623,6 +800,14 @@ Bool_t RooAbsTestStatistic::setData(RooAbsData& indata, Bool_t cloneData)
 
   switch(operMode()) {
   case Slave:
+    // Thread clones always take a private copy of the data, as the current
+    // event of a dataset cannot be shared between threads
+    if (_mtGofArray) {
+      for (Int_t i = 0; i < _nThreads - 1; ++i) {
+	_mtGofArray[i]->setDataSlave(indata, kTRUE);
+      }
+      _mtSerial = kTRUE ;
+    }
     // Delegate to implementation
     return setDataSlave(indata, cloneData);
   case SimMaster:
@@ -680,6 +865,9 @@ void RooAbsTestStatistic::enableOffsetting(Bool_t flag)
       _offset = 0 ;
       _offsetCarry = 0;
     }
+    for (Int_t i = 0; _mtGofArray && i < _nThreads - 1; ++i) {
+      _mtGofArray[i]->enableOffsetting(flag);
+    }
     setValueDirty() ;
     break ;
   case SimMaster:
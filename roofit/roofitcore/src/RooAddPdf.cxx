@@ -64,6 +64,7 @@ of each coefficient_i.
 #include "TList.h"
 #include "RooAddPdf.h"
 #include "RooDataSet.h"
+#include "RooAbsDataStore.h"
 #include "RooRealProxy.h"
 #include "RooPlot.h"
 #include "RooRealVar.h"
@@ -78,6 +79,7 @@ of each coefficient_i.
 
 #include "Riostream.h"
 #include <algorithm>
+#include <vector>
 
 
 using namespace std;
@@ -860,6 +862,65 @@ Double_t RooAddPdf::evaluate() const
 }
 
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the values of the sum for a range of events, see
+/// RooAbsReal::getValBatch(). The coefficients are calculated once as in
+/// evaluate(), hence kFALSE is returned if any coefficient or projection
+/// integral depends on the observables of the data.
+
+Bool_t RooAddPdf::evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const
+{
+  const RooArgSet* nset = _normSet ;
+  if (nset==0 || nset->getSize()==0) {
+    if (_refCoefNorm.getSize()!=0) {
+      nset = &_refCoefNorm ;
+    }
+  }
+
+  CacheElem* cache = getProjCache(nset) ;
+
+  const RooArgSet& obs = *data.get() ;
+  const RooArgList* coefLists[] = { &_coefList, &cache->_suppNormList, &cache->_projList, &cache->_suppProjList,
+                                    &cache->_refRangeProjList, &cache->_rangeProjList } ;
+  for (Int_t k=0 ; k<6 ; k++) {
+    RooFIter ci = coefLists[k]->fwdIterator() ;
+    RooAbsArg* arg ;
+    while((arg = ci.next())) {
+      if (arg->dependsOnValue(obs)) return kFALSE ;
+    }
+  }
+
+  updateCoefficients(*cache,nset) ;
+
+  std::fill(output,output+n,0.) ;
+  std::vector<Double_t> pdfVal(n) ;
+
+  RooAbsPdf* pdf ;
+  Int_t i(0) ;
+  RooFIter pi = _pdfList.fwdIterator() ;
+  while((pdf = (RooAbsPdf*)pi.next())) {
+    if (pdf->isSelectedComp()) {
+      if (!pdf->getValBatch(pdfVal.data(),data,begin,n,nset)) return kFALSE ;
+      const Double_t coef = _coefCache[i] ;
+      if (cache->_needSupNorm) {
+        const Double_t snormVal = ((RooAbsReal*)cache->_suppNormList.at(i))->getVal() ;
+        for (Int_t j=0 ; j<n ; j++) {
+          output[j] += pdfVal[j]*coef/snormVal ;
+        }
+      } else {
+        for (Int_t j=0 ; j<n ; j++) {
+          output[j] += pdfVal[j]*coef ;
+        }
+      }
+    }
+    i++ ;
+  }
+
+  return kTRUE ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset error counter to given value, limiting the number
 /// of future error messages for this pdf to 'resetValue'
@@ -41,6 +41,7 @@
 
 #include "Riostream.h"
 #include <iomanip>
+#include <mutex>
 #include "TClass.h"
 #include "RooErrorHandler.h"
 #include "RooArgSet.h"
@@ -75,6 +76,10 @@ struct POOLDATA
 
 static std::list<POOLDATA> _memPoolList ;
 
+// Protects the memory pool, as RooArgSets can be created concurrently by
+// test statistics evaluated in multiple threads
+static std::mutex _memPoolMutex ;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear memoery pool on exit to avoid reported memory leaks
 
@@ -103,6 +108,8 @@ void* RooArgSet::operator new (size_t bytes)
 {
   //cout << " RooArgSet::operator new(" << bytes << ")" << endl ;
 
+  std::lock_guard<std::mutex> lock(_memPoolMutex) ;
+
   if (!_poolBegin || _poolCur+(sizeof(RooArgSet)) >= _poolEnd) {
 
     if (_poolBegin!=0) {
@@ -179,6 +186,7 @@ void* RooArgSet::operator new (size_t bytes, void* ptr) noexcept
 void RooArgSet::operator delete (void* ptr)
 {
   // Decrease use count in pool that ptr is on
+  std::lock_guard<std::mutex> lock(_memPoolMutex) ;
   for (std::list<POOLDATA>::iterator poolIter =  _memPoolList.begin() ; poolIter!=_memPoolList.end() ; ++poolIter) {
     if ((char*)ptr > (char*)poolIter->_base && (char*)ptr < (char*)poolIter->_base + POOLSIZE) {
       (*(Int_t*)(poolIter->_base))-- ;
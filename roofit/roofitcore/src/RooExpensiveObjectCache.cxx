@@ -24,6 +24,16 @@ for objects that are expensive to calculate. Owners of such objects
 can registers these here with associated parameter values for which
 the object is valid, so that other instances can, at a later moment
 retrieve these precalculated objects
+
+Besides objects, the cache can hold values (e.g. numeric normalization
+integrals) indexed by a name and the exact values of their parameters.
+Unlike objects, of which only the last one registered under a name is kept,
+a value is stored for every distinct set of parameter values, so that they
+can be reused when the same parameter point is visited again, e.g. at the
+start of each fit of a toy study or along a likelihood profile. The value
+cache is disabled by default and is enabled by setMaxValues(). Its contents
+can be saved to, and merged from, a ROOT file with writeValues() and
+readValues(), to share them between jobs.
 **/
 
 
@@ -34,7 +44,10 @@ retrieve these precalculated objects
 #include "RooAbsCategory.h"
 #include "RooArgSet.h"
 #include "RooMsgService.h"
+#include "TFile.h"
 #include <iostream>
+#include <memory>
+#include <mutex>
 using namespace std ;
 
 #include "RooExpensiveObjectCache.h"
@@ -45,11 +58,15 @@ ClassImp(RooExpensiveObjectCache::ExpensiveObject);
 
 RooExpensiveObjectCache* RooExpensiveObjectCache::_instance = 0 ;
 
+// Protects the value cache, as integrals can be evaluated concurrently by
+// test statistics evaluated in multiple threads
+static std::mutex _valueMapMutex ;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor
 
-RooExpensiveObjectCache::RooExpensiveObjectCache() : _nextUID(0)
+RooExpensiveObjectCache::RooExpensiveObjectCache() : _nextUID(0), _maxValues(0)
 {
 }
 
@@ -59,7 +76,7 @@ RooExpensiveObjectCache::RooExpensiveObjectCache() : _nextUID(0)
 /// Copy constructor
 
 RooExpensiveObjectCache::RooExpensiveObjectCache(const RooExpensiveObjectCache& other) :
-  TObject(other), _nextUID(0)
+  TObject(other), _nextUID(0), _maxValues(other.maxValues())
 {
 }
 
@@ -383,3 +400,188 @@ void RooExpensiveObjectCache::importCacheObjects(RooExpensiveObjectCache& other,
   }
   
 }
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the key of the value cache for given name and the current values of params.
+/// The real-valued parameters are encoded in hexadecimal floating point notation, so
+/// that only identical values match
+
+TString RooExpensiveObjectCache::valueKey(const char* name, const RooArgSet& params) 
+{
+  TString key(name) ;
+  RooFIter iter = params.fwdIterator() ;
+  RooAbsArg* arg ;
+  while((arg=iter.next())) {
+    RooAbsReal* real = dynamic_cast<RooAbsReal*>(arg) ;
+    if (real) {
+      key += TString::Format("|%s=%a",real->GetName(),real->getVal()) ;
+    } else {
+      RooAbsCategory* cat = dynamic_cast<RooAbsCategory*>(arg) ;
+      if (cat) {
+	key += TString::Format("|%s=%d",cat->GetName(),cat->getIndex()) ;
+      }
+    }
+  }
+  return key ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store value under given name for the current values of the parameters in params.
+/// Values registered for other parameter values are kept. If the cache already holds
+/// the maximum number of values, it is cleared first. Returns kTRUE if the value
+/// cache is disabled
+
+Bool_t RooExpensiveObjectCache::registerValue(const char* name, Double_t value, const RooArgSet& params) 
+{
+  if (maxValues()<=0) {
+    return kTRUE ;
+  }
+
+  // The key is computed without the lock, as it evaluates the parameters
+  TString key = valueKey(name,params) ;
+
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  if (_maxValues<=0) {
+    return kTRUE ;
+  }
+  if ((Int_t)_valueMap.size()>=_maxValues) {
+    coutI(Caching) << "RooExpensiveObjectCache::registerValue() value cache is full ("
+		   << _maxValues << " values), clearing it" << endl ;
+    _valueMap.clear() ;
+  }
+  _valueMap[key] = value ;
+
+  return kFALSE ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Retrieve value that was registered under given name for parameters that have
+/// exactly their current values in params. Returns kTRUE if no such value exists
+
+Bool_t RooExpensiveObjectCache::retrieveValue(const char* name, const RooArgSet& params, Double_t& value) const
+{
+  if (maxValues()<=0) {
+    return kTRUE ;
+  }
+
+  TString key = valueKey(name,params) ;
+
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  std::map<TString,Double_t>::const_iterator iter = _valueMap.find(key) ;
+  if (iter==_valueMap.end()) {
+    return kTRUE ;
+  }
+  value = iter->second ;
+  return kFALSE ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of values held by the value cache. A value of zero
+/// (the default) disables the value cache and clears it
+
+void RooExpensiveObjectCache::setMaxValues(Int_t maxValues) 
+{
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  _maxValues = maxValues ;
+  if (_maxValues<=0) {
+    _valueMap.clear() ;
+  }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of values held by the value cache, zero if it is
+/// disabled
+
+Int_t RooExpensiveObjectCache::maxValues() const
+{
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  return _maxValues ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of values in the value cache
+
+Int_t RooExpensiveObjectCache::numValues() const
+{
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  return _valueMap.size() ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Clear all values of the value cache
+
+void RooExpensiveObjectCache::clearValues() 
+{
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  _valueMap.clear() ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the contents of the value cache to given file, which is recreated.
+/// Returns kTRUE in case of an error
+
+Bool_t RooExpensiveObjectCache::writeValues(const char* fileName) const
+{
+  RooExpensiveObjectCache values ;
+  {
+    std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+    values._maxValues = _maxValues ;
+    values._valueMap = _valueMap ;
+  }
+
+  TFile f(fileName,"RECREATE") ;
+  if (f.IsZombie() || f.WriteTObject(&values,"RooExpensiveObjectCache")<=0) {
+    coutE(InputArguments) << "RooExpensiveObjectCache::writeValues() ERROR: cannot write value cache to file " << fileName << endl ;
+    return kTRUE ;
+  }
+  coutI(Caching) << "RooExpensiveObjectCache::writeValues() wrote " << values._valueMap.size() << " values to file " << fileName << endl ;
+  return kFALSE ;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the values stored in given file by writeValues() into the value cache.
+/// Values already in the cache for the same name and parameter values are
+/// replaced. If the value cache is disabled, it is enabled with the maximum
+/// size stored in the file. Returns kTRUE in case of an error
+
+Bool_t RooExpensiveObjectCache::readValues(const char* fileName) 
+{
+  std::unique_ptr<TFile> f(TFile::Open(fileName)) ;
+  if (!f || f->IsZombie()) {
+    coutE(InputArguments) << "RooExpensiveObjectCache::readValues() ERROR: cannot open file " << fileName << endl ;
+    return kTRUE ;
+  }
+  std::unique_ptr<RooExpensiveObjectCache> values(dynamic_cast<RooExpensiveObjectCache*>(f->Get("RooExpensiveObjectCache"))) ;
+  if (!values) {
+    coutE(InputArguments) << "RooExpensiveObjectCache::readValues() ERROR: file " << fileName << " does not contain a value cache" << endl ;
+    return kTRUE ;
+  }
+
+  std::lock_guard<std::mutex> lock(_valueMapMutex) ;
+  if (_maxValues<=0) {
+    _maxValues = values->_maxValues ;
+  }
+  for (std::map<TString,Double_t>::const_iterator iter = values->_valueMap.begin() ; iter!=values->_valueMap.end() ; ++iter) {
+    _valueMap[iter->first] = iter->second ;
+  }
+  coutI(Caching) << "RooExpensiveObjectCache::readValues() read " << values->_valueMap.size() << " values from file " << fileName << endl ;
+  return kFALSE ;
+}
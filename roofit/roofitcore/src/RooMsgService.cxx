@@ -92,6 +92,7 @@ RooMsgService::RooMsgService()
   _showPid = kFALSE ;
   _globMinLevel = DEBUG ;
   _lastMsgLevel = DEBUG ;
+  _errorCount = 0 ;
 
   _devnull = new ofstream("/dev/null") ;
 
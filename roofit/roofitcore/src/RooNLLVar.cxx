@@ -28,6 +28,7 @@ In extended mode, a (Nexpect - Nobserved*log(NExpected) term is added
 **/
 
 #include <algorithm>
+#include <vector>
 
 #include "RooFit.h"
 #include "Riostream.h"
@@ -57,6 +58,7 @@ RooArgSet RooNLLVar::_emptySet ;
 ///  -------------------------|------------
 ///  Extended()               | Include extended term in calculation
 ///  NumCPU()                 | Activate parallel processing feature
+///  NumThreads()             | Share the calculation between threads of the ROOT thread pool
 ///  Range()                  | Fit only selected region
 ///  SumCoefRange()           | Set the range in which to interpret the coefficients of RooAddPdf components
 ///  SplitRange()             | Fit range is split by index catory of simultaneous PDF
@@ -82,6 +84,7 @@ RooNLLVar::RooNLLVar(const char *name, const char* title, RooAbsPdf& pdf, RooAbs
   RooCmdConfig pc("RooNLLVar::RooNLLVar") ;
   pc.allowUndefined() ;
   pc.defineInt("extended","Extended",0,kFALSE) ;
+  pc.defineInt("numThreads","NumThreads",0,1) ;
 
   pc.process(arg1) ;  pc.process(arg2) ;  pc.process(arg3) ;
   pc.process(arg4) ;  pc.process(arg5) ;  pc.process(arg6) ;
@@ -96,6 +99,10 @@ RooNLLVar::RooNLLVar(const char *name, const char* title, RooAbsPdf& pdf, RooAbs
   _offsetCarrySaveW2 = 0.;
 
   _binnedPdf = 0 ;
+
+  if (pc.getInt("numThreads")>1) {
+    setNumThreads(pc.getInt("numThreads")) ;
+  }
 }
 
 
@@ -223,6 +230,8 @@ void RooNLLVar::applyWeightSquared(Bool_t flag)
       std::swap(_offset, _offsetSaveW2);
       std::swap(_offsetCarry, _offsetCarrySaveW2);
     }
+    for (Int_t i=0 ; _mtGofArray && i<_nThreads-1 ; i++)
+      ((RooNLLVar*)_mtGofArray[i])->applyWeightSquared(flag);
     setValueDirty();
   } else if ( _gofOpMode==MPMaster) {
     for (Int_t i=0 ; i<_nCPU ; i++)
@@ -306,8 +315,24 @@ Double_t RooNLLVar::evaluatePartition(Int_t firstEvent, Int_t lastEvent, Int_t s
 
   } else {
 
+    // For consecutive events the p.d.f. is calculated for batches of events
+    // when the data store and the p.d.f. support it (see RooAbsReal::getValBatch()).
+    // Events with an invalid or suspiciously large probability are evaluated
+    // again with getLogVal(), which reports the evaluation error
+    const Int_t batchSize(1024) ;
+    Bool_t useBatch = (stepSize==1) ;
+    std::vector<Double_t> batch ;
+    Int_t batchBegin(firstEvent), batchEnd(firstEvent) ;
+
     for (i=firstEvent ; i<lastEvent ; i+=stepSize) {
 
+      if (useBatch && i>=batchEnd) {
+	batchBegin = i ;
+	batchEnd = std::min(i+batchSize,lastEvent) ;
+	batch.resize(batchEnd-batchBegin) ;
+	useBatch = pdfClone->getValBatch(batch.data(),*_dataClone->store(),batchBegin,batchEnd-batchBegin,_normSet) ;
+      }
+
       _dataClone->get(i) ;
 
       if (!_dataClone->valid()) continue;
@@ -316,7 +341,8 @@ Double_t RooNLLVar::evaluatePartition(Int_t firstEvent, Int_t lastEvent, Int_t s
       if (0. == eventWeight * eventWeight) continue ;
       if (_weightSq) eventWeight = _dataClone->weightSquared() ;
 
-      Double_t term = -eventWeight * pdfClone->getLogVal(_normSet);
+      const Double_t prob = useBatch ? batch[i-batchBegin] : 0. ;
+      Double_t term = (prob>0. && prob<=1e6) ? -eventWeight * log(prob) : -eventWeight * pdfClone->getLogVal(_normSet);
 
 
       Double_t y = eventWeight - sumWeightCarry;
@@ -61,6 +61,7 @@ have to appear in any specific place in the list.
 #include <cstring>
 #include <sstream>
 #include <algorithm>
+#include <vector>
 
 #ifndef _WIN32
 #include <strings.h>
@@ -473,6 +474,17 @@ Double_t RooProdPdf::getValV(const RooArgSet* set) const
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Overload getValBatch() to track normalization set used
+
+Bool_t RooProdPdf::getValBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n, const RooArgSet* set) const
+{
+  _curNormSet = (RooArgSet*)set ;
+  return RooAbsPdf::getValBatch(output,data,begin,n,set) ;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Calculate current value of object
 
@@ -560,6 +572,51 @@ Double_t RooProdPdf::calculate(const RooProdPdf::CacheElem& cache, Bool_t /*verb
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the running product of the p.d.f. terms for a range of events,
+/// see RooAbsReal::getValBatch(). Rearranged products, calculated as a ratio
+/// of integrals, are not supported.
+
+Bool_t RooProdPdf::evaluateBatch(Double_t* output, const RooAbsDataStore& data, Int_t begin, Int_t n) const
+{
+  Int_t code ;
+  CacheElem* cache = (CacheElem*) _cacheMgr.getObj(_curNormSet,0,&code) ;
+
+  // If cache doesn't have our configuration, recalculate here
+  if (!cache) {
+    RooArgList *plist(0) ;
+    RooLinkedList *nlist(0) ;
+    getPartIntList(_curNormSet,0,plist,nlist,code) ;
+    cache = (CacheElem*) _cacheMgr.getObj(_curNormSet,0,&code) ;
+  }
+
+  if (cache->_isRearranged) return kFALSE ;
+
+  std::fill(output,output+n,1.0) ;
+  std::vector<Double_t> piVal(n) ;
+  Bool_t first(kTRUE) ;
+
+  RooAbsReal* partInt;
+  RooArgSet* normSet;
+  RooFIter plIter = cache->_partList.fwdIterator();
+  RooFIter nlIter = cache->_normList.fwdIterator();
+  for (partInt = (RooAbsReal*) plIter.next(),
+      normSet = (RooArgSet*) nlIter.next(); partInt && normSet;
+      partInt = (RooAbsReal*) plIter.next(),
+      normSet = (RooArgSet*) nlIter.next()) {
+    if (!partInt->getValBatch(piVal.data(),data,begin,n,normSet->getSize() > 0 ? normSet : 0)) return kFALSE ;
+    // Events whose running product already dropped below the cutoff keep their value, as in calculate()
+    for (Int_t i=0 ; i<n ; i++) {
+      output[i] = (first || output[i] > _cutOff) ? output[i]*piVal[i] : output[i] ;
+    }
+    first = kFALSE ;
+  }
+
+  return kTRUE ;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Factorize product in irreducible terms for given choice of integration/normalization
 
@@ -893,14 +893,21 @@ Double_t RooRealIntegral::evaluate() const
     {      
       // Cache numeric integrals in >1d expensive object cache
       RooDouble* cacheVal(0) ;
+      Bool_t useValueCache(kFALSE), foundValue(kFALSE) ;
       if ((_cacheNum && _intList.getSize()>0) || _intList.getSize()>=_cacheAllNDim) {
-	cacheVal = (RooDouble*) expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters())  ;
+	// Values of all parameter points seen so far are kept in the value cache, if enabled
+	useValueCache = expensiveObjectCache().maxValues()>0 ;
+	if (useValueCache) {
+	  foundValue = !expensiveObjectCache().retrieveValue(valueCacheKey().Data(),parameters(),retVal) ;
+	} else {
+	  cacheVal = (RooDouble*) expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters())  ;
+	}
       }
 
       if (cacheVal) {
 	retVal = *cacheVal ;
 	//	cout << "using cached value of integral" << GetName() << endl ;
-      } else {
+      } else if (!foundValue) {
 
 
 	// Find any function dependents that are AClean 
@@ -930,7 +937,9 @@ Double_t RooRealIntegral::evaluate() const
 	_sumList=_saveSum ;
 
 	// Cache numeric integrals in >1d expensive object cache
-	if ((_cacheNum && _intList.getSize()>0) || _intList.getSize()>=_cacheAllNDim) {
+	if (useValueCache) {
+	  expensiveObjectCache().registerValue(valueCacheKey().Data(),retVal,parameters()) ;
+	} else if ((_cacheNum && _intList.getSize()>0) || _intList.getSize()>=_cacheAllNDim) {
 	  RooDouble* val = new RooDouble(retVal) ;
 	  expensiveObjectCache().registerObject(_function.arg().GetName(),GetName(),*val,parameters())  ;
 //  	  cout << "### caching value of integral" << GetName() << " in " << &expensiveObjectCache() << endl ;
@@ -1089,6 +1098,7 @@ Bool_t RooRealIntegral::redirectServersHook(const RooAbsCollection& /*newServerL
     delete _params ;
     _params = 0 ;
   }
+  _valueCacheKey.Clear() ;
 
   return kFALSE ;
 }
@@ -1116,6 +1126,48 @@ const RooArgSet& RooRealIntegral::parameters() const
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name under which the values of this integral are stored in the value
+/// cache of the expensive object cache. Besides the name of the integral, which
+/// encodes the integrand, the integration and normalization sets and the range, it
+/// contains a hash of the class and name of all nodes of the integrand, of the
+/// precision of the numeric integrator and of the limits of the numerically
+/// integrated observables, so that values are not shared between integrals of
+/// different models with the same names, or over different ranges. The limits
+/// are read at every call, as the range of an observable can be changed at any time.
+
+TString RooRealIntegral::valueCacheKey() const
+{
+  if (_valueCacheKey.IsNull()) {
+    RooArgSet nodes ;
+    _function.arg().treeNodeServerList(&nodes) ;
+    TString structure ;
+    RooFIter iter = nodes.fwdIterator() ;
+    RooAbsArg* node ;
+    while((node=iter.next())) {
+      structure += TString::Format("%s::%s;",node->ClassName(),node->GetName()) ;
+    }
+    if (_iconfig) {
+      structure += TString::Format("%a;%a",_iconfig->epsAbs(),_iconfig->epsRel()) ;
+    }
+    _valueCacheKey = TString::Format("%s[%08x]",GetName(),structure.Hash()) ;
+  }
+
+  const char* rangeName = _rangeName ? _rangeName->GetName() : 0 ;
+  TString limits ;
+  RooFIter iter = _intList.fwdIterator() ;
+  RooAbsArg* arg ;
+  while((arg=iter.next())) {
+    RooAbsRealLValue* var = dynamic_cast<RooAbsRealLValue*>(arg) ;
+    if (var) {
+      limits += TString::Format("%s=[%a,%a];",var->GetName(),var->getMin(rangeName),var->getMax(rangeName)) ;
+    }
+  }
+  return TString::Format("%s[%08x]",_valueCacheKey.Data(),limits.Hash()) ;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Dummy
 
@@ -640,6 +640,30 @@ Double_t RooVectorDataStore::weight() const
 }
 
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the stored values of 'real' for the n events starting
+/// at 'begin', without loading these events. The columns of the optimization
+/// cache are searched as well. Returns zero if 'real' is not the buffer
+/// argument of any column or if the range exceeds the number of entries.
+
+const Double_t* RooVectorDataStore::getBatch(const RooAbsReal& real, Int_t begin, Int_t n) const
+{
+  if (begin<0 || n<0 || begin+n>_nEntries) return 0 ;
+
+  vector<RealVector*>::const_iterator iter = _realStoreList.begin() ;
+  for ( ; iter!=_realStoreList.end() ; ++iter) {
+    if ((*iter)->_real==&real) return (*iter)->_vec0+begin ;
+  }
+  vector<RealFullVector*>::const_iterator iter2 = _realfStoreList.begin() ;
+  for ( ; iter2!=_realfStoreList.end() ; ++iter2) {
+    if ((*iter2)->_real==&real) return (*iter2)->_vec0+begin ;
+  }
+
+  return _cache ? _cache->getBatch(real,begin,n) : 0 ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Double_t RooVectorDataStore::weightError(RooAbsData::ErrorType etype) const 
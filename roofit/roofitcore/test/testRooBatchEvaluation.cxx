@@ -0,0 +1,168 @@
+#include "RooAddPdf.h"
+#include "RooArgList.h"
+#include "RooArgSet.h"
+#include "RooDataSet.h"
+#include "RooExponential.h"
+#include "RooGaussian.h"
+#include "RooMsgService.h"
+#include "RooPolynomial.h"
+#include "RooProdPdf.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+
+#include "TRandom3.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// Clone of the p.d.f. which reads its observables from the dataset, as the
+// clones evaluated by the likelihoods
+static RooAbsPdf *AttachedClone(const RooAbsPdf &pdf, RooDataSet &data, std::unique_ptr<RooArgSet> &owner)
+{
+   owner.reset(static_cast<RooArgSet *>(RooArgSet(pdf).snapshot(kTRUE)));
+   auto clone = static_cast<RooAbsPdf *>(owner->find(pdf.GetName()));
+   clone->attachDataSet(data);
+   return clone;
+}
+
+// Compare the values of getValBatch() with getVal() event by event
+static void CompareBatch(const RooAbsPdf &pdf, RooDataSet &data)
+{
+   std::unique_ptr<RooArgSet> owner;
+   RooAbsPdf *clone = AttachedClone(pdf, data, owner);
+   const RooArgSet *normSet = data.get();
+   const Int_t n = data.numEntries();
+
+   std::vector<Double_t> batch(n);
+   ASSERT_TRUE(clone->getValBatch(batch.data(), *data.store(), 0, n, normSet)) << pdf.GetName();
+   for (Int_t i = 0; i < n; ++i) {
+      data.get(i);
+      const Double_t value = clone->getVal(normSet);
+      EXPECT_NEAR(batch[i], value, 1.e-12 * std::abs(value)) << pdf.GetName() << " event " << i;
+   }
+
+   // A range in the middle of the data
+   std::vector<Double_t> part(10);
+   ASSERT_TRUE(clone->getValBatch(part.data(), *data.store(), 100, 10, normSet)) << pdf.GetName();
+   for (Int_t i = 0; i < 10; ++i) {
+      EXPECT_DOUBLE_EQ(part[i], batch[100 + i]) << pdf.GetName() << " event " << 100 + i;
+   }
+}
+
+// Compare the likelihood, which uses getValBatch() for consecutive events,
+// with the sum of getLogVal() event by event, and the evaluation errors they log.
+// Returns the likelihood value.
+static Double_t CompareNLL(RooAbsPdf &pdf, RooDataSet &data)
+{
+   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::CountErrors);
+
+   RooAbsReal::clearEvalErrorLog();
+   std::unique_ptr<RooAbsReal> nll(pdf.createNLL(data));
+   const Double_t nllValue = nll->getVal();
+   const Int_t nllErrors = RooAbsReal::numEvalErrors();
+
+   RooAbsReal::clearEvalErrorLog();
+   std::unique_ptr<RooArgSet> owner;
+   RooAbsPdf *clone = AttachedClone(pdf, data, owner);
+   Double_t sum = 0;
+   for (Int_t i = 0; i < data.numEntries(); ++i) {
+      data.get(i);
+      sum -= clone->getLogVal(data.get());
+   }
+   const Int_t errors = RooAbsReal::numEvalErrors();
+
+   RooAbsReal::clearEvalErrorLog();
+   RooAbsReal::setEvalErrorLoggingMode(RooAbsReal::PrintErrors);
+
+   EXPECT_EQ(nllErrors, errors) << pdf.GetName();
+   if (std::isfinite(sum)) {
+      EXPECT_NEAR(nllValue, sum, 1.e-10 * std::abs(sum)) << pdf.GetName();
+   } else {
+      EXPECT_FALSE(std::isfinite(nllValue)) << pdf.GetName();
+   }
+   return nllValue;
+}
+
+class RooBatchEvaluation : public ::testing::Test {
+protected:
+   RooBatchEvaluation()
+      : x("x", "x", -10., 10.), y("y", "y", -5., 5.), mean("mean", "mean", 1., -5., 5.),
+        sigma("sigma", "sigma", 2., 0.1, 10.), c("c", "c", -0.2, -2., 0.), a1("a1", "a1", 0.1, -1., 1.),
+        a2("a2", "a2", 0.02, 0., 1.), frac("frac", "frac", 0.3, 0., 1.), ymean("ymean", "ymean", 0.),
+        ysigma("ysigma", "ysigma", 1.5), gauss("gauss", "gauss", x, mean, sigma), expo("expo", "expo", x, c),
+        poly("poly", "poly", x, RooArgList(a1, a2)), add("add", "add", RooArgList(gauss, expo), RooArgList(frac)),
+        gaussY("gaussY", "gaussY", y, ymean, ysigma), prod("prod", "prod", RooArgList(add, gaussY))
+   {
+      RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+      RooRandom::randomGenerator()->SetSeed(4321);
+   }
+
+   RooRealVar x, y, mean, sigma, c, a1, a2, frac, ymean, ysigma;
+   RooGaussian gauss;
+   RooExponential expo;
+   RooPolynomial poly;
+   RooAddPdf add;
+   RooGaussian gaussY;
+   RooProdPdf prod;
+};
+
+TEST_F(RooBatchEvaluation, Pdfs)
+{
+   for (RooAbsPdf *pdf : std::vector<RooAbsPdf *>{&gauss, &expo, &poly, &add}) {
+      std::unique_ptr<RooDataSet> data(pdf->generate(x, 3000));
+      CompareBatch(*pdf, *data);
+   }
+
+   std::unique_ptr<RooDataSet> data(prod.generate(RooArgSet(x, y), 3000));
+   CompareBatch(prod, *data);
+}
+
+TEST_F(RooBatchEvaluation, NLL)
+{
+   // More events than a batch of the likelihood (1024)
+   for (RooAbsPdf *pdf : std::vector<RooAbsPdf *>{&gauss, &expo, &poly, &add}) {
+      std::unique_ptr<RooDataSet> data(pdf->generate(x, 3000));
+      EXPECT_TRUE(std::isfinite(CompareNLL(*pdf, *data))) << pdf->GetName();
+   }
+
+   std::unique_ptr<RooDataSet> data(prod.generate(RooArgSet(x, y), 3000));
+   EXPECT_TRUE(std::isfinite(CompareNLL(prod, *data)));
+}
+
+TEST_F(RooBatchEvaluation, NLLInvalidProbabilities)
+{
+   TRandom3 rnd(1);
+
+   // 1 - 0.5 x is zero at the upper edge of [0,2]: the events there get a zero
+   // probability from the batch and are evaluated again one by one
+   RooRealVar u("u", "u", 0., 2.);
+   RooRealVar b1("b1", "b1", -0.5);
+   RooPolynomial zeroAtEdge("zeroAtEdge", "zeroAtEdge", u, RooArgList(b1));
+   RooDataSet zeroData("zeroData", "zeroData", RooArgSet(u));
+   for (Int_t i = 0; i < 3000; ++i) {
+      u.setVal(i % 1000 == 999 ? 2. : rnd.Uniform(0., 2.));
+      zeroData.add(RooArgSet(u));
+   }
+   CompareBatch(zeroAtEdge, zeroData);
+   EXPECT_FALSE(std::isfinite(CompareNLL(zeroAtEdge, zeroData)));
+
+   // 1 - 0.4 x is negative above 2.5: the batch gives up and all the events are
+   // evaluated one by one, with an evaluation error for each negative value
+   RooRealVar v("v", "v", 0., 4.);
+   RooRealVar b2("b2", "b2", -0.4);
+   RooPolynomial negative("negative", "negative", v, RooArgList(b2));
+   RooDataSet negativeData("negativeData", "negativeData", RooArgSet(v));
+   for (Int_t i = 0; i < 3000; ++i) {
+      v.setVal(rnd.Uniform(0., 4.));
+      negativeData.add(RooArgSet(v));
+   }
+   const Int_t n = negativeData.numEntries();
+   std::vector<Double_t> batch(n);
+   std::unique_ptr<RooArgSet> owner;
+   RooAbsPdf *clone = AttachedClone(negative, negativeData, owner);
+   EXPECT_FALSE(clone->getValBatch(batch.data(), *negativeData.store(), 0, n, negativeData.get()));
+   EXPECT_TRUE(std::isfinite(CompareNLL(negative, negativeData)));
+}
@@ -0,0 +1,210 @@
+#include "RooArgSet.h"
+#include "RooExpensiveObjectCache.h"
+#include "RooGenericPdf.h"
+#include "RooMsgService.h"
+#include "RooRealIntegral.h"
+#include "RooRealVar.h"
+
+#include "TFile.h"
+#include "TMath.h"
+#include "TStreamerInfo.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+
+static const char *kValueCacheFile = "testRooExpensiveObjectCache.root";
+
+// Access to the key of the values of an integral in the value cache
+struct RooRealIntegralKey : public RooRealIntegral {
+   static TString Get(const RooRealIntegral &integral)
+   {
+      return (integral.*(&RooRealIntegralKey::valueCacheKey))();
+   }
+};
+
+class RooExpensiveObjectCacheTest : public ::testing::Test {
+protected:
+   RooExpensiveObjectCacheTest()
+      : x("x", "x", -10., 10.), s("s", "s", 1., 0.5, 3.), pdf("pdf", "pdf", "exp(-0.5*x*x/(s*s))", RooArgSet(x, s))
+   {
+      RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+      RooExpensiveObjectCache::instance().setMaxValues(1000);
+   }
+
+   ~RooExpensiveObjectCacheTest()
+   {
+      RooExpensiveObjectCache::instance().setMaxValues(0);
+      gSystem->Unlink(kValueCacheFile);
+   }
+
+   // Numeric integral over x, with its values cached
+   RooRealIntegral *Integral(RooAbsPdf &p, RooRealVar &obs)
+   {
+      auto integral = dynamic_cast<RooRealIntegral *>(p.createIntegral(obs));
+      if (integral)
+         integral->setCacheNumeric(kTRUE);
+      return integral;
+   }
+
+   RooRealVar x, s;
+   RooGenericPdf pdf;
+};
+
+TEST_F(RooExpensiveObjectCacheTest, Values)
+{
+   RooExpensiveObjectCache &cache = RooExpensiveObjectCache::instance();
+   RooArgSet params(s);
+   Double_t value = 0.;
+
+   s.setVal(1.);
+   EXPECT_FALSE(cache.registerValue("v", 1., params));
+   s.setVal(2.);
+   EXPECT_FALSE(cache.registerValue("v", 2., params));
+   EXPECT_EQ(cache.numValues(), 2);
+
+   // Only the exact parameter values match
+   s.setVal(1.);
+   EXPECT_FALSE(cache.retrieveValue("v", params, value));
+   EXPECT_EQ(value, 1.);
+   s.setVal(1. + 1.e-15);
+   EXPECT_TRUE(cache.retrieveValue("v", params, value));
+   s.setVal(1.);
+   EXPECT_TRUE(cache.retrieveValue("w", params, value));
+
+   // A full cache is cleared
+   cache.setMaxValues(2);
+   s.setVal(3.);
+   EXPECT_FALSE(cache.registerValue("v", 3., params));
+   EXPECT_EQ(cache.numValues(), 1);
+   EXPECT_FALSE(cache.retrieveValue("v", params, value));
+   EXPECT_EQ(value, 3.);
+
+   // Zero disables and clears the cache
+   cache.setMaxValues(0);
+   EXPECT_EQ(cache.maxValues(), 0);
+   EXPECT_EQ(cache.numValues(), 0);
+   EXPECT_TRUE(cache.registerValue("v", 3., params));
+   EXPECT_TRUE(cache.retrieveValue("v", params, value));
+   EXPECT_EQ(cache.numValues(), 0);
+}
+
+TEST_F(RooExpensiveObjectCacheTest, IntegralValues)
+{
+   RooExpensiveObjectCache &cache = RooExpensiveObjectCache::instance();
+   std::unique_ptr<RooRealIntegral> integral(Integral(pdf, x));
+   ASSERT_NE(integral, nullptr);
+   const TString key = RooRealIntegralKey::Get(*integral);
+   EXPECT_TRUE(key.BeginsWith(integral->GetName()));
+
+   // A value for every parameter point
+   s.setVal(1.);
+   const Double_t value1 = integral->getVal();
+   EXPECT_NEAR(value1, std::sqrt(TMath::TwoPi()), 1.e-5);
+   s.setVal(2.);
+   EXPECT_NEAR(integral->getVal(), 2. * std::sqrt(TMath::TwoPi()), 1.e-5);
+   EXPECT_EQ(cache.numValues(), 2);
+   s.setVal(1.);
+   EXPECT_EQ(integral->getVal(), value1);
+   EXPECT_EQ(cache.numValues(), 2);
+
+   // The value of a revisited point is taken from the cache
+   cache.registerValue(key, 42., RooArgSet(s));
+   s.setVal(2.);
+   integral->getVal();
+   s.setVal(1.);
+   EXPECT_EQ(integral->getVal(), 42.);
+}
+
+TEST_F(RooExpensiveObjectCacheTest, DifferentModelSameNames)
+{
+   RooExpensiveObjectCache &cache = RooExpensiveObjectCache::instance();
+   std::unique_ptr<RooRealIntegral> integral(Integral(pdf, x));
+   ASSERT_NE(integral, nullptr);
+   s.setVal(1.);
+   const Double_t value1 = integral->getVal();
+
+   RooRealVar x2("x", "x", -10., 10.);
+   RooRealVar s2("s", "s", 1., 0.5, 3.);
+   RooGenericPdf pdf2("pdf", "pdf", "2*exp(-0.5*x*x/(s*s))", RooArgSet(x2, s2));
+   std::unique_ptr<RooRealIntegral> integral2(Integral(pdf2, x2));
+   ASSERT_NE(integral2, nullptr);
+   EXPECT_STREQ(integral->GetName(), integral2->GetName());
+   EXPECT_NE(RooRealIntegralKey::Get(*integral), RooRealIntegralKey::Get(*integral2));
+
+   // Same name and parameter values, but no hit
+   EXPECT_NEAR(integral2->getVal(), 2. * value1, 1.e-5);
+   EXPECT_EQ(cache.numValues(), 2);
+}
+
+TEST_F(RooExpensiveObjectCacheTest, DifferentRange)
+{
+   std::unique_ptr<RooRealIntegral> integral(Integral(pdf, x));
+   ASSERT_NE(integral, nullptr);
+   s.setVal(1.);
+   integral->getVal();
+   const TString key = RooRealIntegralKey::Get(*integral);
+   RooExpensiveObjectCache::instance().registerValue(key, 42., RooArgSet(s));
+
+   // Same names and parameter values, but another range of x: no hit
+   x.setRange(-1., 1.);
+   EXPECT_NE(RooRealIntegralKey::Get(*integral), key);
+   s.setVal(2.);
+   s.setVal(1.);
+   EXPECT_NEAR(integral->getVal(), std::sqrt(TMath::TwoPi()) * TMath::Erf(1. / std::sqrt(2.)), 1.e-5);
+
+   // The values of the former range are found again
+   x.setRange(-10., 10.);
+   EXPECT_EQ(RooRealIntegralKey::Get(*integral), key);
+   s.setVal(2.);
+   s.setVal(1.);
+   EXPECT_EQ(integral->getVal(), 42.);
+}
+
+TEST_F(RooExpensiveObjectCacheTest, FileRoundTrip)
+{
+   RooExpensiveObjectCache &cache = RooExpensiveObjectCache::instance();
+   std::unique_ptr<RooRealIntegral> integral(Integral(pdf, x));
+   ASSERT_NE(integral, nullptr);
+   const TString key = RooRealIntegralKey::Get(*integral);
+   s.setVal(1.);
+   cache.registerValue(key, 42., RooArgSet(s));
+   s.setVal(2.);
+   const Double_t value2 = integral->getVal();
+   cache.setMaxValues(500);
+   EXPECT_FALSE(cache.writeValues(kValueCacheFile));
+
+   // The class is stored with the value cache members of version 3
+   {
+      TFile f(kValueCacheFile);
+      auto info = static_cast<TStreamerInfo *>(f.GetStreamerInfoList()->FindObject("RooExpensiveObjectCache"));
+      ASSERT_NE(info, nullptr);
+      EXPECT_EQ(info->GetClassVersion(), 3);
+      EXPECT_NE(info->GetElements()->FindObject("_maxValues"), nullptr);
+      EXPECT_NE(info->GetElements()->FindObject("_valueMap"), nullptr);
+   }
+
+   // Reading enables a disabled cache with the size in the file
+   cache.setMaxValues(0);
+   EXPECT_FALSE(cache.readValues(kValueCacheFile));
+   EXPECT_EQ(cache.maxValues(), 500);
+   EXPECT_EQ(cache.numValues(), 2);
+   EXPECT_TRUE(cache.readValues("doesNotExist.root"));
+
+   Double_t value = 0.;
+   s.setVal(2.);
+   EXPECT_FALSE(cache.retrieveValue(key, RooArgSet(s), value));
+   EXPECT_EQ(value, value2);
+   s.setVal(1.);
+   EXPECT_EQ(integral->getVal(), 42.);
+
+   // The values are merged into the cache, without changing its size
+   cache.setMaxValues(1000);
+   s.setVal(3.);
+   cache.registerValue(key, 43., RooArgSet(s));
+   EXPECT_FALSE(cache.readValues(kValueCacheFile));
+   EXPECT_EQ(cache.maxValues(), 1000);
+   EXPECT_EQ(cache.numValues(), 3);
+}
@@ -0,0 +1,78 @@
+#include "RooAddPdf.h"
+#include "RooArgSet.h"
+#include "RooDataSet.h"
+#include "RooExponential.h"
+#include "RooFitResult.h"
+#include "RooGaussian.h"
+#include "RooGlobalFunc.h"
+#include "RooMsgService.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+
+class RooNLLVarMT : public ::testing::Test {
+protected:
+   RooNLLVarMT()
+      : x("x", "x", 0., 10.), mean("mean", "mean", 5., 0., 10.), sigma("sigma", "sigma", 1., 0.1, 5.),
+        c("c", "c", -0.3, -2., 0.), frac("frac", "frac", 0.4, 0., 1.), gauss("gauss", "gauss", x, mean, sigma),
+        expo("expo", "expo", x, c), model("model", "model", RooArgList(gauss, expo), RooArgList(frac))
+   {
+      RooMsgService::instance().setGlobalKillBelow(RooFit::WARNING);
+      RooRandom::randomGenerator()->SetSeed(1234);
+      data.reset(model.generate(x, 10000));
+      params.reset(model.getParameters(*data));
+      initial.reset(static_cast<RooArgSet *>(params->snapshot()));
+   }
+
+   RooRealVar x, mean, sigma, c, frac;
+   RooGaussian gauss;
+   RooExponential expo;
+   RooAddPdf model;
+   std::unique_ptr<RooDataSet> data;
+   std::unique_ptr<RooArgSet> params;
+   std::unique_ptr<RooArgSet> initial;
+};
+
+TEST_F(RooNLLVarMT, SameValue)
+{
+   std::unique_ptr<RooAbsReal> nll1(model.createNLL(*data, RooFit::NumThreads(1)));
+   std::unique_ptr<RooAbsReal> nll4(model.createNLL(*data, RooFit::NumThreads(4)));
+
+   // The first evaluation of the clones is sequential, the following ones are
+   // done in the threads: check both, at different parameter points
+   for (double m : {5., 4.5, 5.5}) {
+      mean.setVal(m);
+      const double v1 = nll1->getVal();
+      const double v4 = nll4->getVal();
+      EXPECT_NEAR(v1, v4, 1.e-10 * std::abs(v1)) << "mean = " << m;
+   }
+}
+
+TEST_F(RooNLLVarMT, SameFitResult)
+{
+   std::unique_ptr<RooFitResult> res1(
+      model.fitTo(*data, RooFit::NumThreads(1), RooFit::Save(), RooFit::PrintLevel(-1)));
+   *params = *initial;
+   std::unique_ptr<RooFitResult> res4(
+      model.fitTo(*data, RooFit::NumThreads(4), RooFit::Save(), RooFit::PrintLevel(-1)));
+
+   ASSERT_NE(res1, nullptr);
+   ASSERT_NE(res4, nullptr);
+   EXPECT_EQ(res1->status(), 0);
+   EXPECT_EQ(res4->status(), 0);
+   EXPECT_NEAR(res1->minNll(), res4->minNll(), 1.e-6);
+
+   const RooArgList &pars1 = res1->floatParsFinal();
+   const RooArgList &pars4 = res4->floatParsFinal();
+   ASSERT_EQ(pars1.getSize(), pars4.getSize());
+   for (int i = 0; i < pars1.getSize(); ++i) {
+      const auto &p1 = static_cast<const RooRealVar &>(pars1[i]);
+      const auto &p4 = static_cast<const RooRealVar &>(*pars4.find(p1.GetName()));
+      EXPECT_NEAR(p1.getVal(), p4.getVal(), 1.e-3 * p1.getError()) << p1.GetName();
+      EXPECT_NEAR(p1.getError(), p4.getError(), 1.e-2 * p1.getError()) << p1.GetName();
+   }
+}
@@ -0,0 +1,132 @@
+// @(#)root/test:$Id$
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "Riostream.h"
+#include "TH2Poly.h"
+#include "TList.h"
+#include "TMath.h"
+#include "TRandom3.h"
+#include "TStopwatch.h"
+
+//
+// This program benchmarks the fill rate of TH2Poly as a function of the
+// number of bins. The bins are irregular quadrilaterals tiling the
+// histogram, as the cells of a detector: the vertices of a regular grid are
+// moved randomly. A few larger bins overlapping the others are added to
+// check that the first bin containing a point is filled.
+//
+// Usage: th2polybm -h                   - to print a usage info
+//        th2polybm [nfills] [maxbins]   - to run the benchmark
+//
+// parameters:
+//       nfills        - number of random fills for each number of bins
+//       maxbins       - the number of bins goes from 100 to maxbins, by factors of 4
+//
+// The bins found by TH2Poly::FindBin() are compared with the ones found by
+// looping over all bins for the first 1000 fills (in range): the program returns 1 if
+// they differ.
+
+int nfills  = 1000000;   // Number of random fills.
+int maxbins = 102400;    // Maximum number of bins.
+
+//______________________________________________________________________________
+TH2Poly *MakeHisto(Int_t nside, TRandom &rnd)
+{
+   // Make a TH2Poly with nside*nside quadrilateral bins in [0,1]x[0,1],
+   // and 4 bins overlapping them at the corners.
+
+   TH2Poly *h = new TH2Poly("h2polybm", "TH2Poly benchmark", 0, 1, 0, 1);
+   const Double_t step = 1. / nside;
+   const Double_t jitter = 0.3 * step;
+   std::vector<Double_t> vx((nside + 1) * (nside + 1)), vy((nside + 1) * (nside + 1));
+   for (Int_t i = 0; i <= nside; i++) {
+      for (Int_t j = 0; j <= nside; j++) {
+         Bool_t borderx = (i == 0 || i == nside);
+         Bool_t bordery = (j == 0 || j == nside);
+         vx[i + (nside + 1) * j] = i * step + (borderx ? 0 : rnd.Uniform(-jitter, jitter));
+         vy[i + (nside + 1) * j] = j * step + (bordery ? 0 : rnd.Uniform(-jitter, jitter));
+      }
+   }
+   for (Int_t corner = 0; corner < 4; corner++) {
+      Double_t x0 = (corner % 2) ? 0.9 : 0.;
+      Double_t y0 = (corner / 2) ? 0.9 : 0.;
+      h->AddBin(x0, y0, x0 + 0.1, y0 + 0.1);
+   }
+   for (Int_t i = 0; i < nside; i++) {
+      for (Int_t j = 0; j < nside; j++) {
+         Int_t k[4] = {i + (nside + 1) * j, i + 1 + (nside + 1) * j, i + 1 + (nside + 1) * (j + 1),
+                       i + (nside + 1) * (j + 1)};
+         Double_t x[5], y[5];
+         for (Int_t v = 0; v < 5; v++) {
+            x[v] = vx[k[v % 4]];
+            y[v] = vy[k[v % 4]];
+         }
+         h->AddBin(5, x, y);
+      }
+   }
+   return h;
+}
+
+//______________________________________________________________________________
+Int_t FindBinBruteForce(TH2Poly *h, Double_t x, Double_t y)
+{
+   TIter next(h->GetBins());
+   TH2PolyBin *bin;
+   while ((bin = (TH2PolyBin *)next())) {
+      if (bin->IsInside(x, y)) return bin->GetBinNumber();
+   }
+   return -5;
+}
+
+//______________________________________________________________________________
+int main(int argc, char **argv)
+{
+   if (argc > 1 && !strcmp(argv[1], "-h")) {
+      std::cout << "Usage: th2polybm [nfills] [maxbins]" << std::endl;
+      return 0;
+   }
+   if (argc > 1) nfills  = atoi(argv[1]);
+   if (argc > 2) maxbins = atoi(argv[2]);
+
+   TRandom3 rnd(4357);
+   std::vector<Double_t> x(nfills), y(nfills);
+   for (Int_t i = 0; i < nfills; i++) {
+      x[i] = rnd.Uniform(-0.01, 1.01);
+      y[i] = rnd.Uniform(-0.01, 1.01);
+   }
+
+   int iret = 0;
+   printf("%10s %12s %12s %14s\n", "bins", "AddBin (s)", "Fill (s)", "fill rate (kHz)");
+   for (Int_t nbins = 100; nbins <= maxbins; nbins *= 4) {
+      Int_t nside = TMath::Nint(TMath::Sqrt(nbins));
+      TStopwatch timer;
+
+      timer.Start();
+      TH2Poly *h = MakeHisto(nside, rnd);
+      timer.Stop();
+      Double_t tadd = timer.CpuTime();
+
+      for (Int_t i = 0; i < 1000 && i < nfills; i++) {
+         if (x[i] <= 0 || x[i] > 1 || y[i] <= 0 || y[i] > 1) continue; // under/overflows
+         if (h->FindBin(x[i], y[i]) != FindBinBruteForce(h, x[i], y[i])) {
+            printf("FAILED: wrong bin for (%g, %g) with %d bins\n", x[i], y[i], h->GetNumberOfBins());
+            iret = 1;
+            break;
+         }
+      }
+
+      timer.Start();
+      for (Int_t i = 0; i < nfills; i++) h->Fill(x[i], y[i]);
+      timer.Stop();
+      Double_t tfill = timer.CpuTime();
+
+      printf("%10d %12.3f %12.3f %14.0f\n", h->GetNumberOfBins(), tadd, tfill,
+             tfill > 0 ? nfills / tfill / 1000 : 0.);
+      delete h;
+   }
+   return iret;
+}
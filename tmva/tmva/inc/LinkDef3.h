@@ -40,6 +40,7 @@
 #pragma link C++ class TMVA::PDEFoamKernelLinN+;
 #pragma link C++ class TMVA::PDEFoamKernelGauss+;
 #pragma link C++ class TMVA::BDTEventWrapper+;
+#pragma link C++ class TMVA::BDTFlatForest+;
 #pragma link C++ class TMVA::CCTreeWrapper+;
 #pragma link C++ class TMVA::CCPruner+;
 #pragma link C++ class TMVA::CostComplexityPruneTool+;
@@ -0,0 +1,84 @@
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : BDTFlatForest                                                         *
+ * Web    : http://tmva.sourceforge.net                                           *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Flattened copy of a forest of decision trees, for fast evaluation         *
+ *                                                                                *
+ * Copyright (c) 2018:                                                            *
+ *      CERN, Switzerland                                                         *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://tmva.sourceforge.net/LICENSE)                                          *
+ **********************************************************************************/
+
+#ifndef ROOT_TMVA_BDTFlatForest
+#define ROOT_TMVA_BDTFlatForest
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+namespace TMVA {
+
+   class DecisionTree;
+   class DecisionTreeNode;
+
+   class BDTFlatForest {
+
+   public:
+
+      BDTFlatForest();
+      ~BDTFlatForest();
+
+      // Copy the trees of the forest into the flat arrays
+      /**
+       * @param forest - the trees, all of them are copied
+       * @param useYesNoLeaf - for classification trees, use the leaf type (+-1) rather than the purity
+       * @return false if the forest cannot be flattened (multivariate Fisher cuts or
+       *         incomplete trees); the forest is then empty
+       */
+      Bool_t Build( const std::vector<DecisionTree*>& forest, Bool_t useYesNoLeaf );
+
+      void Clear();
+
+      UInt_t GetNTrees() const { return fTreeRoot.size(); }
+      UInt_t GetNVariables() const { return fNVars; }
+
+      // Add the weighted responses of a range of trees for a batch of events
+      /**
+       * @param values - the variables of the events, values[ievt*stride + ivar]
+       * @param nEvents - the number of events
+       * @param stride - the distance between two events in values (>= GetNVariables())
+       * @param weights - the weight of each tree, or 0 for weights 1
+       * @param out - the weighted responses are added to out[ievt]
+       * @param firstTree, nTrees, treeStep - the trees firstTree, firstTree+treeStep, ...
+       *        up to firstTree+nTrees (excluded) are evaluated, in this order
+       */
+      void Evaluate( const Float_t* values, UInt_t nEvents, UInt_t stride, const Double_t* weights, Double_t* out,
+                     UInt_t firstTree, UInt_t nTrees, UInt_t treeStep = 1 ) const;
+
+   private:
+
+      UInt_t NewNodes( UInt_t n );
+      Bool_t FillNode( UInt_t index, const DecisionTreeNode* node, Bool_t doRegression, Bool_t useYesNoLeaf,
+                       UInt_t depth, UInt_t& maxDepth );
+
+      // one entry per node: a node at index i goes to fChild[i] + (x[fSelector[i]] >= fCut[i]);
+      // the leaves point to themselves with a cut that never passes
+      std::vector<UInt_t>   fSelector;  // variable used by the cut of each node
+      std::vector<Float_t>  fCut;       // cut value of each node (NaN for the leaves)
+      std::vector<UInt_t>   fChild;     // index of the child taken when the cut fails
+      std::vector<Double_t> fValue;     // response of the leaves
+
+      std::vector<UInt_t>   fTreeRoot;  // index of the root node of each tree
+      std::vector<UInt_t>   fTreeDepth; // maximum depth of each tree
+      UInt_t                fNVars;     // number of variables used by the cuts
+   };
+
+} // namespace TMVA
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "Cpu/CpuBuffer.h"
 #include "Cpu/CpuMatrix.h"
+#include "TMVA/DNN/Functions.h"
 
 namespace TMVA
 {
@@ -61,6 +62,15 @@ public:
    /** Add the vectors biases row-wise to the matrix output */
    static void AddRowWise(TCpuMatrix<Scalar_t> &output,
                           const TCpuMatrix<Scalar_t> &biases);
+   /** Add the vectors biases row-wise to the matrix output, write the first
+    *  partial derivatives of the activation function \p f at the result into
+    *  \p df and apply \p f to \p output. Equivalent to AddRowWise followed by
+    *  evaluateDerivative and evaluate, but done in a single parallel pass
+    *  over the matrix. */
+   static void AddRowWiseActivation(TCpuMatrix<Scalar_t> &output,
+                                    TCpuMatrix<Scalar_t> &df,
+                                    const TCpuMatrix<Scalar_t> &biases,
+                                    EActivationFunction f);
    ///@}
 
    /** @name Backward Propagation
@@ -49,6 +49,10 @@ private:
 
    static std::vector<AFloat> fOnes;  ///< Vector filled with ones used for BLAS calls.
 
+   /** Minimum number of matrix elements processed by one task of the thread
+    *  pool: smaller matrices are processed in a single task. */
+   static const size_t fgMinElementsPerTask = 4096;
+
    TCpuBuffer<AFloat> fBuffer; ///< The buffer holding the matrix elements
                                ///< in column-major format.
    size_t     fNCols;
@@ -89,6 +93,14 @@ public:
    template <typename Function_t>
    void MapFrom(Function_t &f, const TCpuMatrix & A);
 
+   /** Call \p f(begin, end) for consecutive ranges covering the indices 0 to
+    *  \p n - 1, where each index stands for \p elementsPerIndex matrix elements
+    *  (e.g. the number of rows if the indices are columns). The ranges are
+    *  processed in parallel using TThreadExecutor, with at least
+    *  fgMinElementsPerTask elements per range. */
+   template <typename Function_t>
+   void ForEachRange(Function_t &f, size_t n, size_t elementsPerIndex = 1) const;
+
    size_t GetNrows() const {return fNRows;}
    size_t GetNcols() const {return fNCols;}
    size_t GetNElements() const {return fNRows * fNCols;}
@@ -122,13 +134,14 @@ inline void TCpuMatrix<AFloat>::Map(Function_t &f)
 {
    AFloat  *data = GetRawDataPointer();
 
-   auto ff = [data, &f](UInt_t workerID)
+   auto ff = [data, &f](size_t begin, size_t end)
    {
-      data[workerID] = f(data[workerID]);
-      return 0;
+      for (size_t i = begin; i < end; i++) {
+         data[i] = f(data[i]);
+      }
    };
 
-   GetThreadExecutor().Map(ff, ROOT::TSeqI(fNCols * fNRows));
+   ForEachRange(ff, fNCols * fNRows);
 }
 
 template<typename AFloat>
@@ -138,13 +151,38 @@ inline void TCpuMatrix<AFloat>::MapFrom(Function_t &f, const TCpuMatrix &A)
          AFloat  *dataB = GetRawDataPointer();
    const AFloat  *dataA = A.GetRawDataPointer();
 
-   auto ff = [&dataB, &dataA, &f](UInt_t workerID)
+   auto ff = [dataB, dataA, &f](size_t begin, size_t end)
+   {
+      for (size_t i = begin; i < end; i++) {
+         dataB[i] = f(dataA[i]);
+      }
+   };
+
+   ForEachRange(ff, fNCols * fNRows);
+}
+
+template<typename AFloat>
+template<typename Function_t>
+inline void TCpuMatrix<AFloat>::ForEachRange(Function_t &f, size_t n,
+                                             size_t elementsPerIndex) const
+{
+   size_t nRanges = (n * elementsPerIndex) / fgMinElementsPerTask;
+   if (nRanges > n) nRanges = n;
+   if (nRanges <= 1) {
+      if (n > 0) f(size_t(0), n);
+      return;
+   }
+   size_t rangeSize = (n + nRanges - 1) / nRanges;
+   nRanges = (n + rangeSize - 1) / rangeSize;
+
+   auto ff = [&f, n, rangeSize](UInt_t iRange)
    {
-      dataB[workerID] = f(dataA[workerID]);
-      return 0;
+      size_t begin = iRange * rangeSize;
+      size_t end   = (begin + rangeSize < n) ? begin + rangeSize : n;
+      f(begin, end);
    };
 
-   GetThreadExecutor().Map(ff, ROOT::TSeqI(fNCols * fNRows));
+   GetThreadExecutor().Foreach(ff, ROOT::TSeqU(nRanges));
 }
 
 } // namespace DNN
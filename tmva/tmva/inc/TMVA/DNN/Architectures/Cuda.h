@@ -22,6 +22,7 @@
 #include "Cuda/CudaBuffers.h"
 #include "Cuda/CudaMatrix.h"
 #include "TMVA/DNN/DataLoader.h"
+#include "TMVA/DNN/Functions.h"
 #include <utility>
 
 namespace TMVA
@@ -65,6 +66,14 @@ public:
    /** Add the vectors biases row-wise to the matrix output */
    static void AddRowWise(TCudaMatrix<AFloat> &output,
                           const TCudaMatrix<AFloat> &biases);
+   /** Add the vectors biases row-wise to the matrix output, write the first
+    *  partial derivatives of the activation function \p f at the result into
+    *  \p df and apply \p f to \p output. Equivalent to AddRowWise followed by
+    *  evaluateDerivative and evaluate. */
+   static void AddRowWiseActivation(TCudaMatrix<AFloat> &output,
+                                    TCudaMatrix<AFloat> &df,
+                                    const TCudaMatrix<AFloat> &biases,
+                                    EActivationFunction f);
    ///@}
 
    /** @name Backward Propagation
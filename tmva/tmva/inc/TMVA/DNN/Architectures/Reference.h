@@ -19,6 +19,7 @@
 #define TMVA_DNN_ARCHITECTURES_REFERENCE
 
 #include "TMatrix.h"
+#include "TMVA/DNN/Functions.h"
 #include "TMVA/DNN/Architectures/Reference/DataLoader.h"
 
 namespace TMVA
@@ -60,6 +61,14 @@ public:
    /** Add the vectors biases row-wise to the matrix output */
    static void AddRowWise(TMatrixT<Scalar_t> &output,
                           const TMatrixT<Scalar_t> &biases);
+   /** Add the vectors biases row-wise to the matrix output, write the first
+    *  partial derivatives of the activation function \p f at the result into
+    *  \p df and apply \p f to \p output. Equivalent to AddRowWise followed by
+    *  evaluateDerivative and evaluate. */
+   static void AddRowWiseActivation(TMatrixT<Scalar_t> &output,
+                                    TMatrixT<Scalar_t> &df,
+                                    const TMatrixT<Scalar_t> &biases,
+                                    EActivationFunction f);
    ///@}
 
    /** @name Backward Propagation
@@ -270,9 +270,7 @@ auto inline TLayer<Architecture_t>::Forward(Matrix_t & input,
       Architecture_t::Dropout(input, fDropoutProbability);
    }
    Architecture_t::MultiplyTranspose(fOutput, input, fWeights);
-   Architecture_t::AddRowWise(fOutput, fBiases);
-   evaluateDerivative<Architecture_t>(fDerivatives, fF, fOutput);
-   evaluate<Architecture_t>(fOutput, fF);
+   Architecture_t::AddRowWiseActivation(fOutput, fDerivatives, fBiases, fF);
 }
 
 //______________________________________________________________________________
@@ -347,9 +345,7 @@ auto inline TSharedLayer<Architecture_t>::Forward(Matrix_t & input,
       Architecture_t::Dropout(input, fDropoutProbability);
    }
    Architecture_t::MultiplyTranspose(fOutput, input, fWeights);
-   Architecture_t::AddRowWise(fOutput, fBiases);
-   evaluateDerivative<Architecture_t>(fDerivatives, fF, fOutput);
-   evaluate<Architecture_t>(fOutput, fF);
+   Architecture_t::AddRowWiseActivation(fOutput, fDerivatives, fBiases, fF);
 }
 
 //______________________________________________________________________________
@@ -61,6 +61,7 @@ namespace TMVA {
    private:
 
       static const Int_t fgRandomSeed; // set nonzero for debugging and zero for random seeds
+      static const UInt_t fgMinEventsParallel; // minimum (events x variables) of a node to scan the variables in parallel
 
    public:
 
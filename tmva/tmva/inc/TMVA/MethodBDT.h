@@ -50,6 +50,7 @@
 namespace TMVA {
 
    class SeparationBase;
+   class BDTFlatForest;
 
    class MethodBDT : public MethodBase {
 
@@ -98,11 +99,20 @@ namespace TMVA {
       // calculate the MVA value
       Double_t GetMvaValue( Double_t* err = 0, Double_t* errUpper = 0);
 
+      // calculate the MVA values of a range of events of the current data type
+      std::vector<Double_t> GetMvaValues( Long64_t firstEvt = 0, Long64_t lastEvt = -1, Bool_t logProgress = false );
+
+      // calculate the MVA values of a batch of events (one event per row)
+      std::vector<Double_t> GetMvaValues( const TMatrixF& events );
+
       // get the actual forest size (might be less than fNTrees, the requested one, if boosting is stopped early
       UInt_t   GetNTrees() const {return fForest.size();}
    private:
       Double_t GetMvaValue( Double_t* err, Double_t* errUpper, UInt_t useNTrees );
       Double_t PrivateGetMvaValue( const TMVA::Event *ev, Double_t* err=0, Double_t* errUpper=0, UInt_t useNTrees=0 );
+      Bool_t   UseFlatForest();
+      void     ResetFlatForest();
+      void     GetFlatMvaValues( const Float_t* values, UInt_t nEvents, UInt_t stride, Double_t* mvaValues, UInt_t useNTrees=0 ) const;
       void     BoostMonitor(Int_t iTree);
 
    public:
@@ -199,6 +209,9 @@ namespace TMVA {
 
       Int_t                           fNTrees;          // number of decision trees requested
       std::vector<DecisionTree*>      fForest;          // the collection of decision trees
+      BDTFlatForest*                  fFlatForest;      //! flattened copy of the forest used for the evaluation
+      Bool_t                          fFlatForestOK;    //! the forest could be flattened (no Fisher cuts)
+      std::vector<Float_t>            fFlatValues;      //! variables of the events evaluated with the flat forest
       std::vector<double>             fBoostWeights;    // the weights applied in the individual boosts
       Double_t                        fSigToBkgFraction;// Signal to Background fraction assumed during training
       TString                         fBoostType;       // string specifying the boost type
@@ -47,6 +47,7 @@
 #include "assert.h"
 
 #include "TString.h"
+#include "TMatrixFfwd.h"
 
 #include "TMVA/IMethod.h"
 #include "TMVA/Configurable.h"
@@ -198,6 +199,9 @@ namespace TMVA {
       // signal/background classification response
       Double_t GetMvaValue( const TMVA::Event* const ev, Double_t* err = 0, Double_t* errUpper = 0 );
 
+      // signal/background classification response for a batch of events (one event per row)
+      virtual std::vector<Double_t> GetMvaValues( const TMatrixF& events );
+
    protected:
       // helper function to set errors to -1
       void NoErrorCalc(Double_t* const err, Double_t* const errUpper);
@@ -408,6 +412,7 @@ namespace TMVA {
       UInt_t           GetNEvents      () const { return Data()->GetNEvents(); }
       const Event*     GetEvent        () const;
       const Event*     GetEvent        ( const TMVA::Event* ev ) const;
+      void             GetBatchInputs  ( const TMatrixF& events, Int_t firstEvt, Int_t lastEvt, Float_t* inputs ) const;
       const Event*     GetEvent        ( Long64_t ievt ) const;
       const Event*     GetEvent        ( Long64_t ievt , Types::ETreeType type ) const;
       const Event*     GetTrainingEvent( Long64_t ievt ) const;
@@ -38,6 +38,7 @@
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
+#include <memory>
 #include <vector>
 #include "TString.h"
 #include "TTree.h"
@@ -112,6 +113,11 @@ private:
 
    KeyValueVector_t fSettings;
 
+   static const size_t fgBatchSize; // number of events propagated together by GetMvaValues
+
+   struct TBatchNet;                      // copy of fNet used by GetMvaValues, defined in the source file
+   std::unique_ptr<TBatchNet> fBatchNet;  //! cached between the calls of GetMvaValues
+
    ClassDef(MethodDNN,0); // neural network
 
    static inline void WriteMatrixXML(void *parent, const char *name,
@@ -146,6 +152,8 @@ public:
    void TrainCpu();
 
    virtual Double_t GetMvaValue( Double_t* err=0, Double_t* errUpper=0 );
+   using MethodBase::GetMvaValues;
+   virtual std::vector<Double_t> GetMvaValues( const TMatrixF& events );
    virtual const std::vector<Float_t>& GetRegressionValues();
    virtual const std::vector<Float_t>& GetMulticlassValues();
 
@@ -49,6 +49,9 @@
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
 
+#include "TMatrixFfwd.h"
+#include "TMatrixDfwd.h"
+
 #include <vector>
 #include <map>
 #include <stdexcept>
@@ -92,6 +95,10 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns the MVA responses for a batch of events (one event per row)
+      std::vector<Double_t> EvaluateMVA( const TMatrixF& events, const TString& methodTag, Double_t aux = 0 );
+      std::vector<Double_t> EvaluateMVA( const TMatrixD& events, const TString& methodTag, Double_t aux = 0 );
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
@@ -0,0 +1,185 @@
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : BDTFlatForest                                                         *
+ * Web    : http://tmva.sourceforge.net                                           *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Flattened copy of a forest of decision trees, for fast evaluation         *
+ *                                                                                *
+ * Copyright (c) 2018:                                                            *
+ *      CERN, Switzerland                                                         *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://tmva.sourceforge.net/LICENSE)                                          *
+ **********************************************************************************/
+
+/*! \class TMVA::BDTFlatForest
+\ingroup TMVA
+
+Flattened copy of a forest of decision trees, used by MethodBDT to
+evaluate the trained trees.
+
+The nodes of all the trees are stored in contiguous arrays: the variable
+and the value of the cut of each node, the index of its children (which
+are stored next to each other) and the response of the leaves. An event
+at node i moves to the node fChild[i] + (x[fSelector[i]] >= fCut[i]); the
+leaves point to themselves with a cut that never passes (NaN). An event
+hence reaches its leaf after a fixed number of steps (the depth of the
+tree), without any branch or virtual call, and the events of a batch are
+moved through a tree together, which lets the compiler vectorize the
+steps across the events.
+
+The response of a tree for an event is the same as the one of
+DecisionTree::CheckEvent(). Trees with multivariate (Fisher) cuts are not
+supported.
+*/
+
+#include "TMVA/BDTFlatForest.h"
+
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+
+#include <algorithm>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////
+/// default constructor: empty forest
+
+TMVA::BDTFlatForest::BDTFlatForest() :
+   fNVars(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// destructor
+
+TMVA::BDTFlatForest::~BDTFlatForest()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// remove all the trees
+
+void TMVA::BDTFlatForest::Clear()
+{
+   fSelector.clear();
+   fCut.clear();
+   fChild.clear();
+   fValue.clear();
+   fTreeRoot.clear();
+   fTreeDepth.clear();
+   fNVars = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// copy the trees of the forest into the flat arrays
+
+Bool_t TMVA::BDTFlatForest::Build( const std::vector<DecisionTree*>& forest, Bool_t useYesNoLeaf )
+{
+   Clear();
+   for (UInt_t itree=0; itree<forest.size(); itree++) {
+      const DecisionTreeNode* root = forest[itree]->GetRoot();
+      const UInt_t rootIndex = NewNodes(1);
+      UInt_t maxDepth = 0;
+      if (!root || !FillNode( rootIndex, root, forest[itree]->DoRegression(), useYesNoLeaf, 0, maxDepth )) {
+         Clear();
+         return kFALSE;
+      }
+      fTreeRoot.push_back(rootIndex);
+      fTreeDepth.push_back(maxDepth);
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// append n nodes, return the index of the first one
+
+UInt_t TMVA::BDTFlatForest::NewNodes( UInt_t n )
+{
+   const UInt_t first = fSelector.size();
+   fSelector.resize(first+n);
+   fCut.resize(first+n);
+   fChild.resize(first+n);
+   fValue.resize(first+n);
+   return first;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the entry index with the node, and (recursively) the entries of its
+/// children. As in DecisionTree::CheckEvent(), every node that is not of
+/// type 0 is a leaf (also the nodes removed by the pruning). Returns false if
+/// the node cannot be flattened.
+
+Bool_t TMVA::BDTFlatForest::FillNode( UInt_t index, const DecisionTreeNode* node, Bool_t doRegression,
+                                      Bool_t useYesNoLeaf, UInt_t depth, UInt_t& maxDepth )
+{
+   if (node->GetNodeType() != 0) {
+      fSelector[index] = 0;
+      fCut[index]      = std::numeric_limits<Float_t>::quiet_NaN();
+      fChild[index]    = index;
+      if (doRegression) fValue[index] = node->GetResponse();
+      else if (useYesNoLeaf) fValue[index] = Double_t(node->GetNodeType());
+      else fValue[index] = node->GetPurity();
+      maxDepth = std::max(maxDepth, depth);
+      return kTRUE;
+   }
+
+   const DecisionTreeNode* left  = node->GetLeft();
+   const DecisionTreeNode* right = node->GetRight();
+   if (!left || !right || node->GetNFisherCoeff() != 0) return kFALSE;
+
+   // the events passing the cut go right for the cut type kTRUE, left otherwise
+   const DecisionTreeNode* fail = node->GetCutType() ? left : right;
+   const DecisionTreeNode* pass = node->GetCutType() ? right : left;
+
+   const UInt_t first = NewNodes(2);
+   fSelector[index] = node->GetSelector();
+   fCut[index]      = node->GetCutValue();
+   fChild[index]    = first;
+   fValue[index]    = 0;
+   fNVars = std::max(fNVars, UInt_t(node->GetSelector()+1));
+
+   return FillNode( first, fail, doRegression, useYesNoLeaf, depth+1, maxDepth ) &&
+          FillNode( first+1, pass, doRegression, useYesNoLeaf, depth+1, maxDepth );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the weighted responses of the trees firstTree, firstTree+treeStep, ...
+/// (up to firstTree+nTrees) to out[ievt], for the nEvents events whose variables
+/// are stored in values[ievt*stride + ivar]. The trees are added in this order
+/// for each event. The events are processed in blocks, each block is moved
+/// through one tree at a time.
+
+void TMVA::BDTFlatForest::Evaluate( const Float_t* values, UInt_t nEvents, UInt_t stride, const Double_t* weights,
+                                    Double_t* out, UInt_t firstTree, UInt_t nTrees, UInt_t treeStep ) const
+{
+   const UInt_t kBlockSize = 64;
+   UInt_t index[kBlockSize];
+
+   const UInt_t*   selector = fSelector.data();
+   const Float_t*  cut      = fCut.data();
+   const UInt_t*   child    = fChild.data();
+   const Double_t* value    = fValue.data();
+   const UInt_t    lastTree = std::min(GetNTrees(), firstTree + nTrees);
+
+   for (UInt_t begin=0; begin<nEvents; begin+=kBlockSize) {
+      const UInt_t n = std::min(kBlockSize, nEvents-begin);
+      const Float_t* x = values + (Long64_t)begin*stride;
+      Double_t* result = out + begin;
+
+      for (UInt_t itree=firstTree; itree<lastTree; itree+=treeStep) {
+         const UInt_t root = fTreeRoot[itree];
+         for (UInt_t k=0; k<n; k++) index[k] = root;
+         for (UInt_t depth=0; depth<fTreeDepth[itree]; depth++) {
+            for (UInt_t k=0; k<n; k++) {
+               const UInt_t i = index[k];
+               index[k] = child[i] + (x[k*stride + selector[i]] >= cut[i]);
+            }
+         }
+         const Double_t w = weights ? weights[itree] : 1.;
+         for (UInt_t k=0; k<n; k++) result[k] += w * value[index[k]];
+      }
+   }
+}
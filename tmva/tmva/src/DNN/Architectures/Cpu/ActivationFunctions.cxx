@@ -22,12 +22,149 @@ namespace TMVA
 namespace DNN
 {
 
+namespace {
+
+//______________________________________________________________________________
+//
+// Value and first derivative of the activation functions for a single
+// element, shared by the element-wise kernels and the fused kernel of
+// AddRowWiseActivation.
+//______________________________________________________________________________
+
+template<typename AFloat>
+struct TIdentityFunction
+{
+   static AFloat Value(AFloat x)      {return x;}
+   static AFloat Derivative(AFloat)   {return 1.0;}
+};
+
+template<typename AFloat>
+struct TReluFunction
+{
+   static AFloat Value(AFloat x)      {return (x < 0.0) ? 0.0 : x;}
+   static AFloat Derivative(AFloat x) {return (x < 0.0) ? 0.0 : 1.0;}
+};
+
+template<typename AFloat>
+struct TSigmoidFunction
+{
+   static AFloat Value(AFloat x)      {return 1.0 / (1.0 + exp(-x));}
+   static AFloat Derivative(AFloat x)
+   {
+      AFloat sig = 1.0 / (1.0 + exp(-x));
+      return sig * (1.0 - sig);
+   }
+};
+
+template<typename AFloat>
+struct TTanhFunction
+{
+   static AFloat Value(AFloat x)      {return tanh(x);}
+   static AFloat Derivative(AFloat x)
+   {
+      AFloat t = tanh(x);
+      return 1 - t * t;
+   }
+};
+
+template<typename AFloat>
+struct TSymmetricReluFunction
+{
+   static AFloat Value(AFloat x)      {return fabs(x);}
+   static AFloat Derivative(AFloat x) {return (x < 0.0) ? -1.0 : 1.0;}
+};
+
+template<typename AFloat>
+struct TSoftSignFunction
+{
+   static AFloat Value(AFloat x)      {return x / (1 + fabs(x));}
+   static AFloat Derivative(AFloat x)
+   {
+      x = 1.0 + fabs(x);
+      x = 1.0 / (x * x);
+      return x;
+   }
+};
+
+template<typename AFloat>
+struct TGaussFunction
+{
+   static AFloat Value(AFloat x)      {return exp(- x * x);}
+   static AFloat Derivative(AFloat x) {return - 2.0 * x * exp(- x * x);}
+};
+
+//______________________________________________________________________________
+// Add the biases to the columns of output, write the derivatives of the
+// activation function into df and apply the activation function to output,
+// in a single pass over the matrix. The columns (neurons) are distributed
+// over the thread pool.
+template<typename Function_t, typename AFloat>
+void AddRowWiseActivationKernel(TCpuMatrix<AFloat> & output,
+                                TCpuMatrix<AFloat> & df,
+                                const TCpuMatrix<AFloat> & biases)
+{
+   size_t m = output.GetNrows();
+
+         AFloat * dataOutput = output.GetRawDataPointer();
+         AFloat * dataDf     = df.GetRawDataPointer();
+   const AFloat * dataBiases = biases.GetRawDataPointer();
+
+   auto f = [dataOutput, dataDf, dataBiases, m](size_t begin, size_t end)
+   {
+      for (size_t j = begin; j < end; j++) {
+         AFloat b = dataBiases[j];
+         for (size_t i = j * m; i < (j + 1) * m; i++) {
+            AFloat x = dataOutput[i] + b;
+            dataDf[i]     = Function_t::Derivative(x);
+            dataOutput[i] = Function_t::Value(x);
+         }
+      }
+   };
+
+   output.ForEachRange(f, output.GetNcols(), m);
+}
+
+} // namespace
+
+//______________________________________________________________________________
+template<typename AFloat>
+void TCpu<AFloat>::AddRowWiseActivation(TCpuMatrix<AFloat> & output,
+                                        TCpuMatrix<AFloat> & df,
+                                        const TCpuMatrix<AFloat> & biases,
+                                        EActivationFunction f)
+{
+   switch(f)
+   {
+   case EActivationFunction::kIdentity :
+      AddRowWiseActivationKernel<TIdentityFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kRelu :
+      AddRowWiseActivationKernel<TReluFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kSigmoid :
+      AddRowWiseActivationKernel<TSigmoidFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kTanh :
+      AddRowWiseActivationKernel<TTanhFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kSymmRelu :
+      AddRowWiseActivationKernel<TSymmetricReluFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kSoftSign :
+      AddRowWiseActivationKernel<TSoftSignFunction<AFloat>>(output, df, biases);
+      break;
+   case EActivationFunction::kGauss :
+      AddRowWiseActivationKernel<TGaussFunction<AFloat>>(output, df, biases);
+      break;
+   }
+}
+
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::IdentityDerivative(TCpuMatrix<AFloat> & B,
                                       const TCpuMatrix<AFloat> &/*A*/)
 {
-   auto f = [](AFloat) {return 1.0;};
+   auto f = [](AFloat x) {return TIdentityFunction<AFloat>::Derivative(x);};
    B.Map(f);
 }
 
@@ -35,16 +172,16 @@ void TCpu<AFloat>::IdentityDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::Relu(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return (x < 0.0) ? 0.0 : x;};
+   auto f = [](AFloat x) {return TReluFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::ReluDerivative(TCpuMatrix<AFloat> & B,
-                                               const TCpuMatrix<AFloat> &A)
+                                  const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {return (x < 0.0) ? 0.0 : 1.0;};
+   auto f = [](AFloat x) {return TReluFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
@@ -52,19 +189,16 @@ void TCpu<AFloat>::ReluDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::Sigmoid(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return 1.0 / (1.0 + exp(-x));};
+   auto f = [](AFloat x) {return TSigmoidFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::SigmoidDerivative(TCpuMatrix<AFloat> & B,
-                                     const TCpuMatrix<AFloat> &A)
+                                     const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {
-      AFloat sig = 1.0 / (1.0 + exp(-x));
-      return sig * (1.0 - sig);
-   };
+   auto f = [](AFloat x) {return TSigmoidFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
@@ -72,19 +206,16 @@ void TCpu<AFloat>::SigmoidDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::Tanh(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return tanh(x);};
+   auto f = [](AFloat x) {return TTanhFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::TanhDerivative(TCpuMatrix<AFloat> & B,
-                                  const TCpuMatrix<AFloat> &A)
+                                  const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {
-      AFloat t = tanh(x);
-      return 1 - t * t;
-   };
+   auto f = [](AFloat x) {return TTanhFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
@@ -92,18 +223,16 @@ void TCpu<AFloat>::TanhDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::SymmetricRelu(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return fabs(x);};
+   auto f = [](AFloat x) {return TSymmetricReluFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::SymmetricReluDerivative(TCpuMatrix<AFloat> & B,
-                                           const TCpuMatrix<AFloat> &A)
+                                           const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {
-      return (x < 0.0) ? -1.0 : 1.0;
-   };
+   auto f = [](AFloat x) {return TSymmetricReluFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
@@ -111,20 +240,16 @@ void TCpu<AFloat>::SymmetricReluDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::SoftSign(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return x / (1 + fabs(x));};
+   auto f = [](AFloat x) {return TSoftSignFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::SoftSignDerivative(TCpuMatrix<AFloat> & B,
-                                      const TCpuMatrix<AFloat> &A)
+                                      const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {
-      x = 1.0 + fabs(x);
-      x = 1.0 / (x * x);
-      return x;
-   };
+   auto f = [](AFloat x) {return TSoftSignFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
@@ -132,16 +257,16 @@ void TCpu<AFloat>::SoftSignDerivative(TCpuMatrix<AFloat> & B,
 template<typename AFloat>
 void TCpu<AFloat>::Gauss(TCpuMatrix<AFloat> & B)
 {
-   auto f = [](AFloat x) {return exp(- x * x);};
+   auto f = [](AFloat x) {return TGaussFunction<AFloat>::Value(x);};
    B.Map(f);
 }
 
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::GaussDerivative(TCpuMatrix<AFloat> & B,
-                                   const TCpuMatrix<AFloat> &A)
+                                   const TCpuMatrix<AFloat> & A)
 {
-   auto f = [](AFloat x) {return - 2.0 * x * exp(- x * x);};
+   auto f = [](AFloat x) {return TGaussFunction<AFloat>::Derivative(x);};
    B.MapFrom(f, A);
 }
 
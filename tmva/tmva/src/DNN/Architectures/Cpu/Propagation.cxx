@@ -74,8 +74,28 @@ void TCpu<AFloat>::Backward(
     const TCpuMatrix<AFloat> & weights,
     const TCpuMatrix<AFloat> & activationsBackward)
 {
-   // Compute element-wise product.
-   Hadamard(df, activationGradients);
+   // Compute the element-wise product and the bias gradients (the column
+   // sums of the product) in a single pass over the columns of df.
+   size_t m = df.GetNrows();
+
+         AFloat * dataDf        = df.GetRawDataPointer();
+   const AFloat * dataGradients = activationGradients.GetRawDataPointer();
+         AFloat * dataBiases    = (biasGradients.GetNElements() > 0) ?
+                                  biasGradients.GetRawDataPointer() : nullptr;
+
+   auto f = [dataDf, dataGradients, dataBiases, m](size_t begin, size_t end)
+   {
+      for (size_t j = begin; j < end; j++) {
+         AFloat sum = 0.0;
+         for (size_t i = j * m; i < (j + 1) * m; i++) {
+            dataDf[i] *= dataGradients[i];
+            sum += dataDf[i];
+         }
+         if (dataBiases) dataBiases[j] = sum;
+      }
+   };
+
+   df.ForEachRange(f, df.GetNcols(), m);
 
    // Activation gradients.
    if (activationGradientsBackward.GetNElements() > 0)
@@ -84,10 +104,6 @@ void TCpu<AFloat>::Backward(
    // Weight gradients.
    if (weightGradients.GetNElements() > 0)
        TransposeMultiply(weightGradients, df, activationsBackward);
-
-   // Bias gradients.
-   if (biasGradients.GetNElements() > 0)
-       SumColumns(biasGradients, df);
 }
 
 } // namespace DNN
@@ -57,14 +57,15 @@ void TCpu<AFloat>::AddL1RegularizationGradients(
          AFloat  *dataB     =  B.GetRawDataPointer();
    const AFloat  *dataA      = A.GetRawDataPointer();
 
-   auto f = [&dataA, &dataB, weightDecay](UInt_t workerID)
+   auto f = [dataA, dataB, weightDecay](size_t begin, size_t end)
    {
-      AFloat sign = (dataA[workerID] < 0.0) ? -1.0 : 1.0;
-      dataB[workerID] += weightDecay * sign;
-      return 0;
+      for (size_t i = begin; i < end; i++) {
+         AFloat sign = (dataA[i] < 0.0) ? -1.0 : 1.0;
+         dataB[i] += weightDecay * sign;
+      }
    };
 
-   B.GetThreadExecutor().Map(f, ROOT::TSeqI(B.GetNElements()));
+   B.ForEachRange(f, B.GetNElements());
 }
 
 //______________________________________________________________________________
@@ -103,13 +104,14 @@ void TCpu<AFloat>::AddL2RegularizationGradients(
          AFloat  *dataB     =  B.GetRawDataPointer();
    const AFloat  *dataA      = A.GetRawDataPointer();
 
-   auto f = [&dataA, &dataB, weightDecay](UInt_t workerID)
+   auto f = [dataA, dataB, weightDecay](size_t begin, size_t end)
    {
-      dataB[workerID] += 2.0 * weightDecay * dataA[workerID];
-      return 0;
+      for (size_t i = begin; i < end; i++) {
+         dataB[i] += 2.0 * weightDecay * dataA[i];
+      }
    };
 
-   B.GetThreadExecutor().Map(f, ROOT::TSeqI(B.GetNElements()));
+   B.ForEachRange(f, B.GetNElements());
 }
 
 } // namespace DNN
@@ -87,6 +87,18 @@ void TCuda<AFloat>::AddRowWise(TCudaMatrix<AFloat> &Weights,
        Weights.GetNcols());
 }
 
+//____________________________________________________________________________
+template<typename AFloat>
+void TCuda<AFloat>::AddRowWiseActivation(TCudaMatrix<AFloat> &output,
+                                         TCudaMatrix<AFloat> &df,
+                                         const TCudaMatrix<AFloat> &biases,
+                                         EActivationFunction f)
+{
+   AddRowWise(output, biases);
+   evaluateDerivative<TCuda<AFloat>>(df, f, output);
+   evaluate<TCuda<AFloat>>(output, f);
+}
+
 //____________________________________________________________________________
 template<typename AFloat>
 void TCuda<AFloat>::Backward(TCudaMatrix<AFloat> & activation_gradients_backward,
@@ -38,6 +38,15 @@ void TReference<AReal>::AddRowWise(TMatrixT<AReal> &output, const TMatrixT<AReal
    }
 }
 
+template <typename AReal>
+void TReference<AReal>::AddRowWiseActivation(TMatrixT<AReal> &output, TMatrixT<AReal> &df,
+                                             const TMatrixT<AReal> &biases, EActivationFunction f)
+{
+   AddRowWise(output, biases);
+   evaluateDerivative<TReference<AReal>>(df, f, output);
+   evaluate<TReference<AReal>>(output, f);
+}
+
 template <typename AReal>
 void TReference<AReal>::Backward(TMatrixT<AReal> &activation_gradients_backward, TMatrixT<AReal> &weight_gradients,
                                  TMatrixT<AReal> &bias_gradients, TMatrixT<AReal> &df,
@@ -68,8 +68,10 @@ more signal respective background events from the training sample.
 #include "TRandom3.h"
 #include "TMath.h"
 #include "TMatrix.h"
+#include "TROOT.h"
 
 #include "TMVA/MsgLogger.h"
+#include "TMVA/Config.h"
 #include "TMVA/DecisionTree.h"
 #include "TMVA/DecisionTreeNode.h"
 #include "TMVA/BinarySearchTree.h"
@@ -87,6 +89,7 @@ more signal respective background events from the training sample.
 #include "TMVA/ExpectedErrorPruneTool.h"
 
 const Int_t TMVA::DecisionTree::fgRandomSeed = 0; // set nonzero for debugging and zero for random seeds
+const UInt_t TMVA::DecisionTree::fgMinEventsParallel = 10000; // minimum (events x variables) of a node to scan the variables in parallel
 
 using std::vector;
 
@@ -930,7 +933,7 @@ void TMVA::DecisionTree::GetRandomisedVariables(Bool_t *useVariable, UInt_t *map
 Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                                             TMVA::DecisionTreeNode *node )
 {
-   Double_t  separationGainTotal = -1, sepTmp;
+   Double_t  separationGainTotal = -1;
    Double_t *separationGain    = new Double_t[fNvars+1];
    Int_t    *cutIndex          = new Int_t[fNvars+1];  //-1;
 
@@ -1130,7 +1133,6 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
    nTotS=0; nTotB=0;
    nTotS_unWeighted=0; nTotB_unWeighted=0;
    for (UInt_t iev=0; iev<nevents; iev++) {
-
       Double_t eventWeight =  eventSample[iev]->GetWeight();
       if (eventSample[iev]->GetClass() == fSigClass) {
          nTotS+=eventWeight;
@@ -1139,50 +1141,113 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
          nTotB+=eventWeight;
          nTotB_unWeighted++;
       }
+   }
 
-      Int_t iBin=-1;
-      for (UInt_t ivar=0; ivar < cNvars; ivar++) {
-         // now scan trough the cuts for each variable and find which one gives
-         // the best separationGain at the current stage.
-         if ( useVariable[ivar] ) {
-            Double_t eventData;
-            if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar);
-            else { // the fisher variable
-               eventData = fisherCoeff[fNvars];
-               for (UInt_t jvar=0; jvar<fNvars; jvar++)
-                  eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
+   // fill the "histogram" of one variable, turn it into a cumulative distribution
+   // and find the cut that gives the best separationGain for this variable. The
+   // variables only write to their own arrays, so that they can be processed in
+   // parallel; the events are always added in the same order, hence the result
+   // does not depend on the number of threads.
+   auto trainVariable = [&](UInt_t ivar) {
+      if (!useVariable[ivar]) return;
+
+      for (UInt_t iev=0; iev<nevents; iev++) {
+         Double_t eventWeight =  eventSample[iev]->GetWeight();
+         Double_t eventData;
+         if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar);
+         else { // the fisher variable
+            eventData = fisherCoeff[fNvars];
+            for (UInt_t jvar=0; jvar<fNvars; jvar++)
+               eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
 
-            }
-            // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
-            iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-            if (eventSample[iev]->GetClass() == fSigClass) {
-               nSelS[ivar][iBin]+=eventWeight;
-               nSelS_unWeighted[ivar][iBin]++;
-            }
-            else {
-               nSelB[ivar][iBin]+=eventWeight;
-               nSelB_unWeighted[ivar][iBin]++;
-            }
+         }
+         // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
+         Int_t iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
+         if (eventSample[iev]->GetClass() == fSigClass) {
+            nSelS[ivar][iBin]+=eventWeight;
+            nSelS_unWeighted[ivar][iBin]++;
+         }
+         else {
+            nSelB[ivar][iBin]+=eventWeight;
+            nSelB_unWeighted[ivar][iBin]++;
+         }
+         if (DoRegression()) {
+            target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
+            target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
+         }
+      }
+
+      // now turn the "histogram" into a cumulative distribution
+      for (UInt_t ibin=1; ibin < nBins[ivar]; ibin++) {
+         nSelS[ivar][ibin]+=nSelS[ivar][ibin-1];
+         nSelS_unWeighted[ivar][ibin]+=nSelS_unWeighted[ivar][ibin-1];
+         nSelB[ivar][ibin]+=nSelB[ivar][ibin-1];
+         nSelB_unWeighted[ivar][ibin]+=nSelB_unWeighted[ivar][ibin-1];
+         if (DoRegression()) {
+            target[ivar][ibin] +=target[ivar][ibin-1] ;
+            target2[ivar][ibin]+=target2[ivar][ibin-1];
+         }
+      }
+
+      // now select the optimal cut for this variable
+      for (UInt_t iBin=0; iBin<nBins[ivar]-1; iBin++) { // the last bin contains "all events" -->skip
+         // the separationGain is defined as the various indices (Gini, CorssEntropy, e.t.c)
+         // calculated by the "SamplePurities" from the branches that would go to the
+         // left or the right from this node if "these" cuts were used in the Node:
+         // hereby: nSelS and nSelB would go to the right branch
+         //        (nTotS - nSelS) + (nTotB - nSelB)  would go to the left branch;
+
+         // only allow splits where both daughter nodes match the specified minimum number
+         // for this use the "unweighted" events, as you are interested in statistically
+         // significant splits, which is determined by the actual number of entries
+         // for a node, rather than the sum of event weights.
+
+         Double_t sl = nSelS_unWeighted[ivar][iBin];
+         Double_t bl = nSelB_unWeighted[ivar][iBin];
+         Double_t s  = nTotS_unWeighted;
+         Double_t b  = nTotB_unWeighted;
+         Double_t slW = nSelS[ivar][iBin];
+         Double_t blW = nSelB[ivar][iBin];
+         Double_t sW  = nTotS;
+         Double_t bW  = nTotB;
+         Double_t sr = s-sl;
+         Double_t br = b-bl;
+         Double_t srW = sW-slW;
+         Double_t brW = bW-blW;
+         //            std::cout << "sl="<<sl << " bl="<<bl<<" fMinSize="<<fMinSize << "sr="<<sr << " br="<<br  <<std::endl;
+         if ( ((sl+bl)>=fMinSize && (sr+br)>=fMinSize)
+              && ((slW+blW)>=fMinSize && (srW+brW)>=fMinSize)
+              ) {
+
+            Double_t sepTmp;
             if (DoRegression()) {
-               target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-               target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
+               sepTmp = fRegType->GetSeparationGain(nSelS[ivar][iBin]+nSelB[ivar][iBin],
+                                                    target[ivar][iBin],target2[ivar][iBin],
+                                                    nTotS+nTotB,
+                                                    target[ivar][nBins[ivar]-1],target2[ivar][nBins[ivar]-1]);
+            } else {
+               sepTmp = fSepType->GetSeparationGain(nSelS[ivar][iBin], nSelB[ivar][iBin], nTotS, nTotB);
+            }
+            if (separationGain[ivar] < sepTmp) {
+               separationGain[ivar] = sepTmp;
+               cutIndex[ivar]       = iBin;
             }
          }
       }
+   };
+
+#ifdef R__USE_IMT
+   // only worth it if there are enough events in the node
+   if (ROOT::IsImplicitMTEnabled() && cNvars > 1 && nevents*cNvars >= fgMinEventsParallel) {
+      TMVA::Config::Instance().GetThreadExecutor().Foreach(trainVariable, ROOT::TSeqU(cNvars));
+   } else
+#endif
+   {
+      for (UInt_t ivar=0; ivar < cNvars; ivar++) trainVariable(ivar);
    }
-   // now turn the "histogram" into a cumulative distribution
+
    for (UInt_t ivar=0; ivar < cNvars; ivar++) {
       if (useVariable[ivar]) {
-         for (UInt_t ibin=1; ibin < nBins[ivar]; ibin++) {
-            nSelS[ivar][ibin]+=nSelS[ivar][ibin-1];
-            nSelS_unWeighted[ivar][ibin]+=nSelS_unWeighted[ivar][ibin-1];
-            nSelB[ivar][ibin]+=nSelB[ivar][ibin-1];
-            nSelB_unWeighted[ivar][ibin]+=nSelB_unWeighted[ivar][ibin-1];
-            if (DoRegression()) {
-               target[ivar][ibin] +=target[ivar][ibin-1] ;
-               target2[ivar][ibin]+=target2[ivar][ibin-1];
-            }
-         }
          if (nSelS_unWeighted[ivar][nBins[ivar]-1] +nSelB_unWeighted[ivar][nBins[ivar]-1] != eventSample.size()) {
             Log() << kFATAL << "Helge, you have a bug ....nSelS_unw..+nSelB_unw..= "
                   << nSelS_unWeighted[ivar][nBins[ivar]-1] +nSelB_unWeighted[ivar][nBins[ivar]-1]
@@ -1199,55 +1264,6 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
          }
       }
    }
-   // now select the optimal cuts for each variable and find which one gives
-   // the best separationGain at the current stage
-   for (UInt_t ivar=0; ivar < cNvars; ivar++) {
-      if (useVariable[ivar]) {
-         for (UInt_t iBin=0; iBin<nBins[ivar]-1; iBin++) { // the last bin contains "all events" -->skip
-            // the separationGain is defined as the various indices (Gini, CorssEntropy, e.t.c)
-            // calculated by the "SamplePurities" from the branches that would go to the
-            // left or the right from this node if "these" cuts were used in the Node:
-            // hereby: nSelS and nSelB would go to the right branch
-            //        (nTotS - nSelS) + (nTotB - nSelB)  would go to the left branch;
-
-            // only allow splits where both daughter nodes match the specified minimum number
-            // for this use the "unweighted" events, as you are interested in statistically
-            // significant splits, which is determined by the actual number of entries
-            // for a node, rather than the sum of event weights.
-
-            Double_t sl = nSelS_unWeighted[ivar][iBin];
-            Double_t bl = nSelB_unWeighted[ivar][iBin];
-            Double_t s  = nTotS_unWeighted;
-            Double_t b  = nTotB_unWeighted;
-            Double_t slW = nSelS[ivar][iBin];
-            Double_t blW = nSelB[ivar][iBin];
-            Double_t sW  = nTotS;
-            Double_t bW  = nTotB;
-            Double_t sr = s-sl;
-            Double_t br = b-bl;
-            Double_t srW = sW-slW;
-            Double_t brW = bW-blW;
-            //            std::cout << "sl="<<sl << " bl="<<bl<<" fMinSize="<<fMinSize << "sr="<<sr << " br="<<br  <<std::endl;
-            if ( ((sl+bl)>=fMinSize && (sr+br)>=fMinSize)
-                 && ((slW+blW)>=fMinSize && (srW+brW)>=fMinSize)
-                 ) {
-
-               if (DoRegression()) {
-                  sepTmp = fRegType->GetSeparationGain(nSelS[ivar][iBin]+nSelB[ivar][iBin],
-                                                       target[ivar][iBin],target2[ivar][iBin],
-                                                       nTotS+nTotB,
-                                                       target[ivar][nBins[ivar]-1],target2[ivar][nBins[ivar]-1]);
-               } else {
-                  sepTmp = fSepType->GetSeparationGain(nSelS[ivar][iBin], nSelB[ivar][iBin], nTotS, nTotB);
-               }
-               if (separationGain[ivar] < sepTmp) {
-                  separationGain[ivar] = sepTmp;
-                  cutIndex[ivar]       = iBin;
-               }
-            }
-         }
-      }
-   }
 
 
    //now you have found the best separation cut for each variable, now compare the variables
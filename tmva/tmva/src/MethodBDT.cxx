@@ -110,8 +110,10 @@ the selection.
 #include "TMVA/MethodBDT.h"
 
 #include "TMVA/BDTEventWrapper.h"
+#include "TMVA/BDTFlatForest.h"
 #include "TMVA/BinarySearchTree.h"
 #include "TMVA/ClassifierFactory.h"
+#include "TMVA/Config.h"
 #include "TMVA/Configurable.h"
 #include "TMVA/CrossEntropy.h"
 #include "TMVA/DecisionTree.h"
@@ -139,9 +141,11 @@ the selection.
 #include "TDirectory.h"
 #include "TRandom3.h"
 #include "TMath.h"
+#include "TMatrix.h"
 #include "TMatrixTSym.h"
 #include "TObjString.h"
 #include "TGraph.h"
+#include "TROOT.h"
 
 #include <algorithm>
 #include <fstream>
@@ -158,6 +162,27 @@ ClassImp(TMVA::MethodBDT);
 
    const Int_t TMVA::MethodBDT::fgDebugLevel = 0;
 
+namespace {
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Call f(ievt) for the n events of a sample, in parallel on the TMVA thread
+   /// pool if implicit multi-threading is enabled. f must only modify the event
+   /// ievt and the quantities attached to it.
+
+   template <class F>
+   void ForEachEvent(UInt_t n, F f)
+   {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && n > 1) {
+         TMVA::Config::Instance().GetThreadExecutor().Foreach(f, ROOT::TSeqU(n));
+         return;
+      }
+#endif
+      for (UInt_t ievt = 0; ievt < n; ievt++) f(ievt);
+   }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The standard constructor for the "boosted decision trees".
 
@@ -214,6 +239,8 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    fMonitorNtuple = NULL;
    fSepType = NULL;
    fRegressionLossFunctionBDTG = nullptr;
+   fFlatForest = nullptr;
+   fFlatForestOK = kFALSE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +296,8 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    fMonitorNtuple = NULL;
    fSepType = NULL;
    fRegressionLossFunctionBDTG = nullptr;
+   fFlatForest = nullptr;
+   fFlatForestOK = kFALSE;
    // constructor for calculating BDT-MVA using previously generated decision trees
    // the result of the previous training (the decision trees) are read in via the
    // weight file. Make sure the the variables correspond to the ones used in
@@ -729,6 +758,7 @@ void TMVA::MethodBDT::Reset( void )
    // remove all the trees
    for (UInt_t i=0; i<fForest.size();           i++) delete fForest[i];
    fForest.clear();
+   ResetFlatForest();
 
    fBoostWeights.clear();
    if (fMonitorNtuple) { fMonitorNtuple->Delete(); fMonitorNtuple=NULL; }
@@ -752,6 +782,7 @@ void TMVA::MethodBDT::Reset( void )
 TMVA::MethodBDT::~MethodBDT( void )
 {
    for (UInt_t i=0; i<fForest.size();           i++) delete fForest[i];
+   delete fFlatForest;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1140,6 +1171,7 @@ void TMVA::MethodBDT::SetTuneParameters(std::map<TString,Double_t> tuneParameter
 void TMVA::MethodBDT::Train()
 {
    TMVA::DecisionTreeNode::fgIsTraining=true;
+   ResetFlatForest();
 
    // fill the STL Vector with the event sample
    // (needs to be done here and cannot be done in "init" as the options need to be
@@ -1399,6 +1431,7 @@ void TMVA::MethodBDT::Train()
             << Endl;
    }
    TMVA::DecisionTreeNode::fgIsTraining=false;
+   ResetFlatForest();
 
 
    // reset all previously stored/accumulated BOOST weights in the event sample
@@ -1433,16 +1466,18 @@ Double_t TMVA::MethodBDT::GetGradBoostMVA(const TMVA::Event* e, UInt_t nTrees)
 
 void TMVA::MethodBDT::UpdateTargets(std::vector<const TMVA::Event*>& eventSample, UInt_t cls)
 {
+   // the events are independent: they are updated in parallel (see ForEachEvent),
+   // the residuals map is only read concurrently
+   const DecisionTree* lastTree = fForest.back();
    if (DoMulticlass()) {
       UInt_t nClasses = DataInfo().GetNClasses();
-      std::vector<Double_t> expCache;
-      if (cls == nClasses - 1) {
-         expCache.resize(nClasses);
-      }
-      for (auto e : eventSample) {
-         fResiduals[e].at(cls) += fForest.back()->CheckEvent(e, kFALSE);
-         if (cls == nClasses - 1) {
-            auto &residualsThisEvent = fResiduals[e];
+      Bool_t lastClass = (cls == nClasses - 1);
+      ForEachEvent(eventSample.size(), [&](UInt_t ievt) {
+         const TMVA::Event* e = eventSample[ievt];
+         auto &residualsThisEvent = fResiduals.at(e);
+         residualsThisEvent.at(cls) += lastTree->CheckEvent(e, kFALSE);
+         if (lastClass) {
+            std::vector<Double_t> expCache(nClasses);
             std::transform(residualsThisEvent.begin(),
                            residualsThisEvent.begin() + nClasses,
                            expCache.begin(), [](Double_t d) { return exp(d); });
@@ -1458,15 +1493,16 @@ void TMVA::MethodBDT::UpdateTargets(std::vector<const TMVA::Event*>& eventSample
                const_cast<TMVA::Event *>(e)->SetTarget(i, res);
             }
          }
-      }
+      });
    } else {
-      for (auto e : eventSample) {
-         auto &residualAt0 = fResiduals[e].at(0);
-         residualAt0 += fForest.back()->CheckEvent(e, kFALSE);
+      ForEachEvent(eventSample.size(), [&](UInt_t ievt) {
+         const TMVA::Event* e = eventSample[ievt];
+         auto &residualAt0 = fResiduals.at(e).at(0);
+         residualAt0 += lastTree->CheckEvent(e, kFALSE);
          Double_t p_sig = 1.0 / (1.0 + exp(-2.0 * residualAt0));
          Double_t res = (DataInfo().IsSignal(e) ? 1 : 0) - p_sig;
          const_cast<TMVA::Event *>(e)->SetTarget(0, res);
-      }
+      });
    }
 }
 
@@ -1476,9 +1512,11 @@ void TMVA::MethodBDT::UpdateTargets(std::vector<const TMVA::Event*>& eventSample
 void TMVA::MethodBDT::UpdateTargetsRegression(std::vector<const TMVA::Event*>& eventSample, Bool_t first)
 {
    if(!first){
-      for (std::vector<const TMVA::Event*>::const_iterator e=fEventSample.begin(); e!=fEventSample.end();++e) {
-         fLossFunctionEventInfo[*e].predictedValue += fForest.back()->CheckEvent(*e,kFALSE);
-      }
+      const DecisionTree* lastTree = fForest.back();
+      ForEachEvent(fEventSample.size(), [&](UInt_t ievt) {
+         const TMVA::Event* e = fEventSample[ievt];
+         fLossFunctionEventInfo.at(e).predictedValue += lastTree->CheckEvent(e,kFALSE);
+      });
    }
 
    fRegressionLossFunctionBDTG->SetTargets(eventSample, fLossFunctionEventInfo);
@@ -1494,10 +1532,15 @@ Double_t TMVA::MethodBDT::GradBoost(std::vector<const TMVA::Event*>& eventSample
       Double_t sum2 = 0;
    };
 
+   // find the leaf of each event in parallel, then sum up in the event order
+   std::vector<TMVA::DecisionTreeNode*> eventNodes(eventSample.size());
+   ForEachEvent(eventSample.size(), [&](UInt_t ievt) { eventNodes[ievt] = dt->GetEventNode(*eventSample[ievt]); });
+
    std::unordered_map<TMVA::DecisionTreeNode*, LeafInfo> leaves;
-   for (auto e : eventSample) {
+   for (UInt_t ievt = 0; ievt < eventSample.size(); ievt++) {
+      const TMVA::Event* e = eventSample[ievt];
       Double_t weight = e->GetWeight();
-      TMVA::DecisionTreeNode* node = dt->GetEventNode(*e);
+      TMVA::DecisionTreeNode* node = eventNodes[ievt];
       auto &v = leaves[node];
       auto target = e->GetTarget(cls);
       v.sumWeightTarget += target * weight;
@@ -2232,6 +2275,7 @@ void TMVA::MethodBDT::ReadWeightsFromXML(void* parent) {
    UInt_t i;
    for (i=0; i<fForest.size(); i++) delete fForest[i];
    fForest.clear();
+   ResetFlatForest();
    fBoostWeights.clear();
 
    UInt_t ntrees;
@@ -2307,6 +2351,7 @@ void  TMVA::MethodBDT::ReadWeightsFromStream( std::istream& istr )
 
    for (UInt_t i=0;i<fForest.size();i++) delete fForest[i];
    fForest.clear();
+   ResetFlatForest();
    fBoostWeights.clear();
    Int_t iTree;
    Double_t boostWeight;
@@ -2346,8 +2391,99 @@ Double_t TMVA::MethodBDT::GetMvaValue( Double_t* err, Double_t* errUpper, UInt_t
       Double_t val = ApplyPreselectionCuts(ev);
       if (TMath::Abs(val)>0.05) return val;
    }
-   return PrivateGetMvaValue(ev, err, errUpper, useNTrees);
+   if (!UseFlatForest()) return PrivateGetMvaValue(ev, err, errUpper, useNTrees);
+
+   // cannot determine error
+   NoErrorCalc(err, errUpper);
 
+   const UInt_t nvars = GetNvar();
+   fFlatValues.resize(nvars);
+   for (UInt_t ivar=0; ivar<nvars; ivar++) fFlatValues[ivar] = ev->GetValue(ivar);
+   Double_t mvaValue = 0;
+   GetFlatMvaValues(fFlatValues.data(), 1, nvars, &mvaValue, useNTrees);
+   return mvaValue;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of the events firstEvt to lastEvt (excluded) of the
+/// current data set. The events are evaluated in batches with the flattened
+/// forest (see GetFlatMvaValues), which gives the same values as GetMvaValue().
+
+std::vector<Double_t> TMVA::MethodBDT::GetMvaValues( Long64_t firstEvt, Long64_t lastEvt, Bool_t logProgress )
+{
+   if (!UseFlatForest()) return MethodBase::GetMvaValues(firstEvt, lastEvt, logProgress);
+
+   Long64_t nEvents = Data()->GetNEvents();
+   if (firstEvt > lastEvt || lastEvt > nEvents) lastEvt = nEvents;
+   if (firstEvt < 0) firstEvt = 0;
+   std::vector<Double_t> values(lastEvt-firstEvt);
+   nEvents = values.size();
+
+   // use timer
+   Timer timer( nEvents, GetName(), kTRUE );
+
+   if (logProgress)
+      Log() << kHEADER<<Form("[%s] : ",DataInfo().GetName())<< "Evaluation of " << GetMethodName() << " on "
+            << (Data()->GetCurrentType()==Types::kTraining?"training":"testing") << " sample (" << nEvents << " events)" << Endl;
+
+   const UInt_t  nvars      = GetNvar();
+   const Long64_t kBatchSize = 256;
+   fFlatValues.resize(kBatchSize*nvars);
+   Int_t modulo = Int_t(nEvents/100);
+   if (modulo <= 0 ) modulo = 1;
+
+   for (Long64_t begin=firstEvt; begin<lastEvt; begin+=kBatchSize) {
+      const Long64_t end = std::min(begin+kBatchSize, lastEvt);
+      for (Long64_t ievt=begin; ievt<end; ievt++) {
+         Data()->SetCurrentEvent(ievt);
+         const Event* ev = GetEvent();
+         Float_t* x = &fFlatValues[(ievt-begin)*nvars];
+         for (UInt_t ivar=0; ivar<nvars; ivar++) x[ivar] = ev->GetValue(ivar);
+      }
+      GetFlatMvaValues(fFlatValues.data(), end-begin, nvars, &values[begin-firstEvt]);
+
+      // the preselection cuts override the response of the trees
+      if (fDoPreselection) {
+         for (Long64_t ievt=begin; ievt<end; ievt++) {
+            Data()->SetCurrentEvent(ievt);
+            Double_t val = ApplyPreselectionCuts(GetEvent());
+            if (TMath::Abs(val)>0.05) values[ievt-firstEvt] = val;
+         }
+      }
+
+      // print progress
+      if (logProgress && (begin-firstEvt)/modulo != (end-firstEvt)/modulo) timer.DrawProgressBar( end-firstEvt );
+   }
+   if (logProgress) {
+      Log() << kINFO
+            << "Elapsed time for evaluation of " << nEvents <<  " events: "
+            << timer.GetElapsedTime() << "       " << Endl;
+   }
+
+   return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of a batch of events (one event per row), evaluated
+/// with the flattened forest in blocks of events. Falls back to the event by
+/// event evaluation with preselection cuts or if the forest cannot be flattened.
+
+std::vector<Double_t> TMVA::MethodBDT::GetMvaValues( const TMatrixF& events )
+{
+   if (fDoPreselection || !UseFlatForest()) return MethodBase::GetMvaValues(events);
+
+   const Int_t   nEvents    = events.GetNrows();
+   const UInt_t  nvars      = GetNvar();
+   const Int_t   kBatchSize = 256;
+   std::vector<Double_t> values(nEvents);
+   fFlatValues.resize(kBatchSize*nvars);
+
+   for (Int_t begin=0; begin<nEvents; begin+=kBatchSize) {
+      const Int_t end = std::min(begin+kBatchSize, nEvents);
+      GetBatchInputs(events, begin, end, fFlatValues.data());
+      GetFlatMvaValues(fFlatValues.data(), end-begin, nvars, &values[begin]);
+   }
+   return values;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2378,6 +2514,64 @@ Double_t TMVA::MethodBDT::PrivateGetMvaValue(const TMVA::Event* ev, Double_t* er
    return ( norm > std::numeric_limits<double>::epsilon() ) ? myMVA /= norm : 0 ;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure that the flattened copy of the forest is up to date with the
+/// trees, return false if the trees cannot be evaluated with it (during the
+/// training or for trees with Fisher cuts). The copy is rebuilt when trees
+/// have been added since it was made.
+
+Bool_t TMVA::MethodBDT::UseFlatForest()
+{
+   if (TMVA::DecisionTreeNode::fgIsTraining || fForest.empty()) return kFALSE;
+   if (fFlatForest == nullptr || (fFlatForestOK && fFlatForest->GetNTrees() != fForest.size())) {
+      if (fFlatForest == nullptr) fFlatForest = new BDTFlatForest();
+      // the gradient boosted trees always return the response of the leaves
+      fFlatForestOK = fFlatForest->Build(fForest, fBoostType!="Grad" && fUseYesNoLeaf);
+      if (fFlatForestOK && fFlatForest->GetNVariables() > GetNvar()) {
+         fFlatForest->Clear();
+         fFlatForestOK = kFALSE;
+      }
+   }
+   return fFlatForestOK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// delete the flattened copy of the forest, after the trees have changed
+
+void TMVA::MethodBDT::ResetFlatForest()
+{
+   delete fFlatForest;
+   fFlatForest = nullptr;
+   fFlatForestOK = kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the classification MVA values of nEvents events, whose variables
+/// are stored in values[ievt*stride + ivar], with the flattened forest. The
+/// trees are added in the same order as in PrivateGetMvaValue(), hence the
+/// values are identical. UseFlatForest() must have returned true.
+
+void TMVA::MethodBDT::GetFlatMvaValues( const Float_t* values, UInt_t nEvents, UInt_t stride, Double_t* mvaValues, UInt_t useNTrees ) const
+{
+   UInt_t nTrees = fForest.size();
+   if (useNTrees > 0 ) nTrees = useNTrees;
+
+   std::fill(mvaValues, mvaValues+nEvents, 0.);
+   if (fBoostType=="Grad") {
+      fFlatForest->Evaluate(values, nEvents, stride, 0, mvaValues, 0, nTrees);
+      for (UInt_t ievt=0; ievt<nEvents; ievt++) mvaValues[ievt] = 2.0/(1.0+exp(-2.0*mvaValues[ievt]))-1;
+      return;
+   }
+
+   nTrees = std::min(nTrees, fFlatForest->GetNTrees());
+   Double_t norm = 0;
+   for (UInt_t itree=0; itree<nTrees; itree++) norm += fBoostWeights[itree];
+   if (norm > std::numeric_limits<double>::epsilon()) {
+      fFlatForest->Evaluate(values, nEvents, stride, fBoostWeights.data(), mvaValues, 0, nTrees);
+      for (UInt_t ievt=0; ievt<nEvents; ievt++) mvaValues[ievt] /= norm;
+   }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the multiclass MVA response for the BDT classifier.
@@ -2393,10 +2587,19 @@ const std::vector<Float_t>& TMVA::MethodBDT::GetMulticlassValues()
    auto forestSize = fForest.size();
    // trees 0, nClasses, 2*nClasses, ... belong to class 0
    // trees 1, nClasses+1, 2*nClasses+1, ... belong to class 1 and so forth
-   UInt_t classOfTree = 0;
-   for (UInt_t itree = 0; itree < forestSize; ++itree) {
-      temp[classOfTree] += fForest[itree]->CheckEvent(e, kFALSE);
-      if (++classOfTree == nClasses) classOfTree = 0; // cheap modulo
+   if (UseFlatForest()) {
+      const UInt_t nvars = GetNvar();
+      fFlatValues.resize(nvars);
+      for (UInt_t ivar=0; ivar<nvars; ivar++) fFlatValues[ivar] = e->GetValue(ivar);
+      for (UInt_t iClass=0; iClass<nClasses; iClass++)
+         fFlatForest->Evaluate(fFlatValues.data(), 1, nvars, 0, &temp[iClass], iClass, forestSize, nClasses);
+   }
+   else {
+      UInt_t classOfTree = 0;
+      for (UInt_t itree = 0; itree < forestSize; ++itree) {
+         temp[classOfTree] += fForest[itree]->CheckEvent(e, kFALSE);
+         if (++classOfTree == nClasses) classOfTree = 0; // cheap modulo
+      }
    }
 
    // we want to calculate sum of exp(temp[j] - temp[i]) for all i,j (i!=j)
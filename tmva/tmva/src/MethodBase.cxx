@@ -841,6 +841,46 @@ Double_t TMVA::MethodBase::GetMvaValue( const Event* const ev, Double_t* err, Do
    return val;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of a batch of events, given by the rows of the
+/// matrix (the columns are the input variables, in the order of the
+/// training). The default implementation evaluates the events one by one;
+/// methods that can process several events at once override it.
+
+std::vector<Double_t> TMVA::MethodBase::GetMvaValues( const TMatrixF& events )
+{
+   const Int_t nEvents = events.GetNrows();
+   const Int_t nvars   = events.GetNcols();
+   std::vector<Double_t> values(nEvents);
+
+   Event ev(std::vector<Float_t>(nvars), 0);
+   const Float_t* row = events.GetMatrixArray();
+   for (Int_t ievt=0; ievt<nEvents; ievt++, row+=nvars) {
+      for (Int_t ivar=0; ivar<nvars; ivar++) ev.SetVal(ivar, row[ivar]);
+      values[ievt] = GetMvaValue(&ev);
+   }
+   return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill inputs[(ievt-firstEvt)*GetNvar() + ivar] with the input variables of
+/// the events firstEvt to lastEvt (excluded) of the matrix (one event per
+/// row), after the variable transformations of the method.
+
+void TMVA::MethodBase::GetBatchInputs( const TMatrixF& events, Int_t firstEvt, Int_t lastEvt, Float_t* inputs ) const
+{
+   const Int_t  ncols = events.GetNcols();
+   const UInt_t nvars = GetNvar();
+
+   Event ev(std::vector<Float_t>(ncols), 0);
+   for (Int_t ievt=firstEvt; ievt<lastEvt; ievt++) {
+      const Float_t* row = events.GetMatrixArray() + (Long64_t)ievt*ncols;
+      for (Int_t ivar=0; ivar<ncols; ivar++) ev.SetVal(ivar, row[ivar]);
+      const Event* tev = GetEvent(&ev);
+      for (UInt_t ivar=0; ivar<nvars; ivar++) *inputs++ = tev->GetValue(ivar);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// uses a pre-set cut on the MVA output (SetSignalReferenceCut and SetSignalReferenceCutOrientation)
 /// for a quick determination if an event would be selected as signal or background
@@ -86,6 +86,12 @@
 
    delete reader;
 ~~~
+
+ Events that are already available in memory can also be evaluated in
+ batches: each row of the matrix given to EvaluateMVA( const TMatrixF&, ... )
+ holds the variables of one event, and one MVA value is returned per row.
+ Methods that support it (e.g. DNN and BDT) then process many events at
+ once, the other ones evaluate the events one after the other.
 */
 
 #include "TMVA/Reader.h"
@@ -111,6 +117,8 @@
 #include "TH1D.h"
 #include "TKey.h"
 #include "TVector.h"
+#include "TMatrix.h"
+#include "TMatrixD.h"
 #include "TXMLEngine.h"
 #include "TMath.h"
 
@@ -525,6 +533,60 @@ Double_t TMVA::Reader::EvaluateMVA( const std::vector<Double_t>& inputVec, const
    return EvaluateMVA( fTmpEvalVec, methodTag, aux );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a batch of events for a given method: each row of the matrix holds
+/// the input variables of one event, in the order in which they were declared.
+/// Returns one MVA value per row (-999 for the events with a NaN variable).
+/// The parameter aux is obligatory for the cuts method where it represents the efficiency cutoff
+
+std::vector<Double_t> TMVA::Reader::EvaluateMVA( const TMatrixF& events, const TString& methodTag, Double_t aux )
+{
+   IMethod* imeth = FindMVA( methodTag );
+   MethodBase* meth = dynamic_cast<TMVA::MethodBase*>(imeth);
+   if(meth==0) return std::vector<Double_t>();
+
+   if ((UInt_t)events.GetNcols() != DataInfo().GetNVariables()) {
+      Log() << kERROR << "<EvaluateMVA> the matrix of events has " << events.GetNcols()
+            << " columns, but the reader has " << DataInfo().GetNVariables() << " variables" << Endl;
+      return std::vector<Double_t>();
+   }
+
+   if (meth->GetMethodType() == TMVA::Types::kCuts) {
+      TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(meth);
+      if(mc)
+         mc->SetTestSignalEfficiency( aux );
+   }
+   std::vector<Double_t> values = meth->GetMvaValues( events );
+
+   // events with a NaN variable get the same value as in the single event evaluation
+   const Int_t nvars = events.GetNcols();
+   const Float_t* row = events.GetMatrixArray();
+   Int_t nNaN = 0;
+   for (Int_t ievt=0; ievt<events.GetNrows(); ievt++, row+=nvars) {
+      for (Int_t ivar=0; ivar<nvars; ivar++) {
+         if (TMath::IsNaN(row[ivar])) {
+            values[ievt] = -999;
+            nNaN++;
+            break;
+         }
+      }
+   }
+   if (nNaN > 0)
+      Log() << kERROR << nNaN << " events have a NaN variable --> return MVA value -999 for them, \n that's all I can do, please fix or remove these events." << Endl;
+
+   return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a batch of events given in double precision for a given method
+/// (see the TMatrixF version)
+
+std::vector<Double_t> TMVA::Reader::EvaluateMVA( const TMatrixD& events, const TString& methodTag, Double_t aux )
+{
+   // performs a copy to float values which are internally used by all methods
+   return EvaluateMVA( TMatrixF(events), methodTag, aux );
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
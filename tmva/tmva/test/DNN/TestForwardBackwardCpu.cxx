@@ -0,0 +1,138 @@
+// @(#)root/tmva $Id$
+
+/*************************************************************************
+ * Copyright (C) 2018, Rene Brun and Fons Rademakers.                    *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////
+// Compares the forward and backward propagation of the fused CPU   //
+// kernels with the reference architecture for all activation       //
+// functions. With the option --timing, also measures the time per  //
+// training step of both architectures.                             //
+//////////////////////////////////////////////////////////////////////
+
+#include "TMatrix.h"
+#include "TMVA/DNN/Architectures/Reference.h"
+#include "TMVA/DNN/Architectures/Cpu.h"
+#include "TMVA/DNN/Net.h"
+#include "Utility.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+using namespace TMVA::DNN;
+
+/*! Construct a net with three hidden layers of the given width using the
+ *  activation function f and a linear output layer. */
+//______________________________________________________________________________
+template <typename Architecture>
+void constructNet(TNet<Architecture> &net, size_t width, EActivationFunction f)
+{
+   net.AddLayer(width, f);
+   net.AddLayer(width, f);
+   net.AddLayer(width, f);
+   net.AddLayer(1, EActivationFunction::kIdentity);
+}
+
+/*! Propagate a random batch forward and backward through the same net on
+ *  the reference and the CPU architectures and return the maximum relative
+ *  error of the outputs and of the weight and bias gradients. */
+//______________________________________________________________________________
+Double_t testForwardBackward(EActivationFunction f)
+{
+   using Reference_t = TReference<Double_t>;
+   using Cpu_t       = TCpu<Double_t>;
+
+   const size_t batchSize = 64, inputWidth = 20;
+
+   TNet<Reference_t> referenceNet(batchSize, inputWidth, ELossFunction::kMeanSquaredError);
+   constructNet(referenceNet, 32, f);
+   referenceNet.Initialize(EInitialization::kGauss);
+   TNet<Cpu_t> cpuNet(batchSize, referenceNet);
+
+   TMatrixT<Double_t> X(batchSize, inputWidth), Y(batchSize, 1), W(batchSize, 1);
+   randomMatrix(X);
+   randomMatrix(Y);
+   fillMatrix(W, 1.0);
+   TCpuMatrix<Double_t> cpuX(X), cpuY(Y), cpuW(W);
+
+   referenceNet.Forward(X);
+   referenceNet.Backward(X, Y, W);
+   cpuNet.Forward(cpuX);
+   cpuNet.Backward(cpuX, cpuY, cpuW);
+
+   Double_t error = 0.0;
+   for (size_t l = 0; l < referenceNet.GetDepth(); l++) {
+      auto &referenceLayer = referenceNet.GetLayer(l);
+      auto &cpuLayer       = cpuNet.GetLayer(l);
+      error = std::max(error, maximumRelativeError((TMatrixT<Double_t>) cpuLayer.GetOutput(),
+                                                   referenceLayer.GetOutput()));
+      error = std::max(error, maximumRelativeError((TMatrixT<Double_t>) cpuLayer.GetWeightGradients(),
+                                                   referenceLayer.GetWeightGradients()));
+      error = std::max(error, maximumRelativeError((TMatrixT<Double_t>) cpuLayer.GetBiasGradients(),
+                                                   referenceLayer.GetBiasGradients()));
+   }
+
+   std::cout << "Activation function " << static_cast<int>(f)
+             << ": maximum relative error: " << print_error(error) << std::endl;
+   return error;
+}
+
+/*! Return the average time in milliseconds of a forward and backward
+ *  propagation step of a net with three hidden layers of the given width. */
+//______________________________________________________________________________
+template <typename Architecture>
+Double_t timeTrainingStep(size_t batchSize, size_t inputWidth, size_t width, size_t nSteps)
+{
+   using Matrix_t = typename Architecture::Matrix_t;
+
+   TNet<Architecture> net(batchSize, inputWidth, ELossFunction::kMeanSquaredError);
+   constructNet(net, width, EActivationFunction::kTanh);
+   net.Initialize(EInitialization::kGauss);
+
+   TMatrixT<Double_t> X(batchSize, inputWidth), Y(batchSize, 1), W(batchSize, 1);
+   randomMatrix(X);
+   randomMatrix(Y);
+   fillMatrix(W, 1.0);
+   Matrix_t XArch(X), YArch(Y), WArch(W);
+
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < nSteps; i++) {
+      net.Forward(XArch);
+      net.Backward(XArch, YArch, WArch);
+   }
+   std::chrono::duration<Double_t, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+   return elapsed.count() / nSteps;
+}
+
+int main(int argc, char **argv)
+{
+   std::cout << "Testing forward and backward propagation on the CPU architecture:" << std::endl;
+
+   int iret = 0;
+
+   for (EActivationFunction f : {EActivationFunction::kIdentity, EActivationFunction::kRelu,
+                                 EActivationFunction::kSigmoid, EActivationFunction::kTanh,
+                                 EActivationFunction::kSymmRelu, EActivationFunction::kSoftSign,
+                                 EActivationFunction::kGauss}) {
+      if (testForwardBackward(f) > 1e-10)
+         iret++;
+   }
+
+   // The timing depends on the machine and its load, it is not part of the test
+   if (argc < 2 || strcmp(argv[1], "--timing") != 0)
+      return iret;
+
+   std::cout << "Time per training step (batch size 256, 3 x 256 neurons):" << std::endl;
+   Double_t tReference = timeTrainingStep<TReference<Double_t>>(256, 64, 256, 5);
+   Double_t tCpu       = timeTrainingStep<TCpu<Double_t>>(256, 64, 256, 50);
+   std::cout << "   Reference: " << tReference << " ms" << std::endl;
+   std::cout << "   Cpu:       " << tCpu << " ms (speedup " << tReference / tCpu << ")" << std::endl;
+
+   return iret;
+}
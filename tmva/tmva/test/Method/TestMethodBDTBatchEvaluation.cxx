@@ -0,0 +1,201 @@
+#include "gtest/gtest.h"
+
+#include "TMVA/DataLoader.h"
+#include "TMVA/DecisionTree.h"
+#include "TMVA/Event.h"
+#include "TMVA/Factory.h"
+#include "TMVA/MethodBDT.h"
+#include "TMVA/Reader.h"
+
+#include "TMatrix.h"
+#include "TMatrixD.h"
+#include "TRandom3.h"
+#include "Rtypes.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+namespace TMVA {
+
+//
+// Trains a BDT and compares the MVA values of a batch of events
+// (MethodBDT::GetMvaValues, evaluated with the flattened forest) and of the
+// single event evaluation with the values computed from the trees of the
+// forest, node by node.
+// Also compares the batch and single event evaluations of a DNN (propagated
+// through the network in blocks with the CPU backend) and of the
+// Reader::EvaluateMVA( TMatrix ) interface.
+//
+
+struct TestMethodBDTBatchEvaluation {
+
+   TestMethodBDTBatchEvaluation()
+   {
+      fFactory = unique_ptr<Factory>(new Factory("", "Silent:!DrawProgressBar:AnalysisType=Classification"));
+      fDataLoader = shared_ptr<DataLoader>(new DataLoader("dataset"));
+
+      fDataLoader->AddVariable("x", 'F');
+      fDataLoader->AddVariable("y", 'F');
+      fDataLoader->AddVariable("z", 'F');
+
+      TRandom3 rng(7);
+      for (UInt_t i = 0; i < 2000; ++i) {
+         Types::ETreeType type = (i % 2 == 0) ? Types::kTraining : Types::kTesting;
+         fDataLoader->AddEvent("Signal", type, {rng.Gaus(0.5, 1), rng.Gaus(0.5, 1), rng.Gaus(0, 1)}, 1);
+         fDataLoader->AddEvent("Background", type, {rng.Gaus(-0.5, 1), rng.Gaus(-0.5, 1), rng.Gaus(0, 1)}, 1);
+      }
+      fDataLoader->PrepareTrainingAndTestTree("", "SplitMode=Block:!V");
+
+      fEvents.ResizeTo(500, 3);
+      for (Int_t i = 0; i < fEvents.GetNrows(); ++i) {
+         for (Int_t j = 0; j < fEvents.GetNcols(); ++j) {
+            fEvents(i, j) = rng.Gaus(0, 1.5);
+         }
+      }
+   };
+
+   MethodBase *Train(Types::EMVA type, TString title, TString options)
+   {
+      IMethod *m = fFactory->BookMethod(fDataLoader.get(), type, title, options);
+      fFactory->TrainAllMethods();
+      return dynamic_cast<MethodBase *>(m);
+   };
+
+   MethodBDT *Train(TString title, TString options)
+   {
+      return dynamic_cast<MethodBDT *>(Train(Types::kBDT, title, "!H:!V:NTrees=50:" + options));
+   };
+
+   // response of the forest for one event, node by node
+   Double_t GetReference(const MethodBDT *bdt, const Event *ev, Bool_t grad, Bool_t useYesNoLeaf)
+   {
+      const vector<DecisionTree *> &forest = bdt->GetForest();
+      const vector<double> &weights = bdt->GetBoostWeights();
+      Double_t sum = 0, norm = 0;
+      for (UInt_t itree = 0; itree < forest.size(); itree++) {
+         if (grad) {
+            sum += forest[itree]->CheckEvent(ev, kFALSE);
+         } else {
+            sum += weights[itree] * forest[itree]->CheckEvent(ev, useYesNoLeaf);
+            norm += weights[itree];
+         }
+      }
+      if (grad) return 2.0 / (1.0 + exp(-2.0 * sum)) - 1;
+      return sum / norm;
+   };
+
+   void Verify(MethodBDT *bdt, Bool_t grad, Bool_t useYesNoLeaf)
+   {
+      ASSERT_NE(bdt, nullptr);
+      vector<Double_t> values = bdt->GetMvaValues(fEvents);
+      ASSERT_EQ(values.size(), (size_t)fEvents.GetNrows());
+
+      for (Int_t i = 0; i < fEvents.GetNrows(); ++i) {
+         Event ev({fEvents(i, 0), fEvents(i, 1), fEvents(i, 2)}, 0);
+         Double_t reference = GetReference(bdt, &ev, grad, useYesNoLeaf);
+         EXPECT_DOUBLE_EQ(values[i], reference);
+         EXPECT_DOUBLE_EQ(bdt->MethodBase::GetMvaValue(&ev), reference);
+      }
+   };
+
+   // batch against single event evaluation, for a method without a reference
+   void VerifySingle(MethodBase *method, Double_t tolerance)
+   {
+      ASSERT_NE(method, nullptr);
+      vector<Double_t> values = method->GetMvaValues(fEvents);
+      ASSERT_EQ(values.size(), (size_t)fEvents.GetNrows());
+
+      for (Int_t i = 0; i < fEvents.GetNrows(); ++i) {
+         Event ev({fEvents(i, 0), fEvents(i, 1), fEvents(i, 2)}, 0);
+         EXPECT_NEAR(values[i], method->GetMvaValue(&ev), tolerance);
+      }
+
+      // a second batch of the same size, and a batch of another size
+      EXPECT_EQ(method->GetMvaValues(fEvents), values);
+      TMatrixF few = fEvents.GetSub(0, 9, 0, fEvents.GetNcols() - 1);
+      vector<Double_t> fewValues = method->GetMvaValues(few);
+      ASSERT_EQ(fewValues.size(), 10u);
+      for (Int_t i = 0; i < few.GetNrows(); ++i) {
+         EXPECT_NEAR(fewValues[i], values[i], tolerance);
+      }
+   };
+
+   // Reader::EvaluateMVA for a matrix of events against the single event
+   // evaluation, including an event with a NaN variable
+   void VerifyReader(MethodBase *method, Double_t tolerance)
+   {
+      ASSERT_NE(method, nullptr);
+      Float_t x, y, z;
+      Reader reader("Silent");
+      reader.AddVariable("x", &x);
+      reader.AddVariable("y", &y);
+      reader.AddVariable("z", &z);
+      reader.BookMVA("method", method->GetWeightFileName());
+
+      TMatrixF events(fEvents);
+      events(1, 2) = numeric_limits<Float_t>::quiet_NaN();
+      vector<Double_t> values = reader.EvaluateMVA(events, "method");
+      ASSERT_EQ(values.size(), (size_t)events.GetNrows());
+      EXPECT_EQ(values[1], -999);
+
+      for (Int_t i = 0; i < events.GetNrows(); ++i) {
+         x = events(i, 0);
+         y = events(i, 1);
+         z = events(i, 2);
+         EXPECT_NEAR(values[i], reader.EvaluateMVA("method"), tolerance);
+      }
+
+      EXPECT_EQ(reader.EvaluateMVA(TMatrixD(events), "method"), values);
+   };
+
+private:
+   std::unique_ptr<TMVA::Factory> fFactory;
+   std::shared_ptr<TMVA::DataLoader> fDataLoader;
+   TMatrixF fEvents;
+};
+
+} // End namespace TMVA
+
+TEST(MethodBDTBatchEvaluation, AdaBoost)
+{
+   TMVA::TestMethodBDTBatchEvaluation context;
+   TMVA::MethodBDT *bdt = context.Train("BDTAda", "BoostType=AdaBoost:UseYesNoLeaf=True:MaxDepth=3");
+   context.Verify(bdt, kFALSE, kTRUE);
+}
+
+TEST(MethodBDTBatchEvaluation, RealAdaBoost)
+{
+   TMVA::TestMethodBDTBatchEvaluation context;
+   TMVA::MethodBDT *bdt = context.Train("BDTRealAda", "BoostType=RealAdaBoost:MaxDepth=3");
+   context.Verify(bdt, kFALSE, kFALSE);
+}
+
+TEST(MethodBDTBatchEvaluation, GradBoost)
+{
+   TMVA::TestMethodBDTBatchEvaluation context;
+   TMVA::MethodBDT *bdt = context.Train("BDTG", "BoostType=Grad:Shrinkage=0.1:MaxDepth=4");
+   context.Verify(bdt, kTRUE, kFALSE);
+}
+
+TEST(MethodBDTBatchEvaluation, Reader)
+{
+   TMVA::TestMethodBDTBatchEvaluation context;
+   TMVA::MethodBDT *bdt = context.Train("BDTReader", "BoostType=AdaBoost:MaxDepth=3");
+   context.VerifyReader(bdt, 0);
+}
+
+#ifdef DNNCPU
+TEST(MethodBDTBatchEvaluation, DNNCpu)
+{
+   TMVA::TestMethodBDTBatchEvaluation context;
+   TMVA::MethodBase *dnn = context.Train(TMVA::Types::kDNN, "DNNCpu",
+                                         "!H:!V:Layout=TANH|10,TANH|10,LINEAR:Architecture=CPU:"
+                                         "TrainingStrategy=LearningRate=1e-2,BatchSize=50,ConvergenceSteps=5");
+   context.VerifySingle(dnn, 1e-6);
+   context.VerifyReader(dnn, 1e-6);
+}
+#endif
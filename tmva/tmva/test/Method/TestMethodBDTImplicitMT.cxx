@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include "TMVA/DataLoader.h"
+#include "TMVA/Factory.h"
+#include "TMVA/MethodBDT.h"
+
+#include "TMatrixF.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+#include "Rtypes.h"
+
+#include <memory>
+#include <vector>
+
+#ifdef R__USE_IMT
+
+using namespace std;
+
+namespace TMVA {
+
+//
+// Trains the same BDT with and without implicit multi-threading and checks
+// that the forests are identical: the variables of the large nodes are
+// scanned in parallel and the gradient boosting updates run in parallel over
+// the events, but the results must not depend on it.
+//
+
+struct TestMethodBDTImplicitMT {
+
+   // 5000 training events of 3 variables: the root nodes have more than the
+   // 10000 events x variables (DecisionTree::fgMinEventsParallel) that are
+   // needed to scan the variables in parallel
+   TestMethodBDTImplicitMT()
+   {
+      fFactory = unique_ptr<Factory>(new Factory("", "Silent:!DrawProgressBar:AnalysisType=Classification"));
+      fDataLoader = shared_ptr<DataLoader>(new DataLoader("dataset"));
+
+      fDataLoader->AddVariable("x", 'F');
+      fDataLoader->AddVariable("y", 'F');
+      fDataLoader->AddVariable("z", 'F');
+
+      TRandom3 rng(11);
+      for (UInt_t i = 0; i < 5000; ++i) {
+         Types::ETreeType type = (i % 2 == 0) ? Types::kTraining : Types::kTesting;
+         fDataLoader->AddEvent("Signal", type, {rng.Gaus(0.5, 1), rng.Gaus(0.5, 1), rng.Gaus(0, 1)}, 1);
+         fDataLoader->AddEvent("Background", type, {rng.Gaus(-0.5, 1), rng.Gaus(-0.5, 1), rng.Gaus(0, 1)}, 1);
+      }
+      fDataLoader->PrepareTrainingAndTestTree("", "SplitMode=Block:!V");
+
+      fEvents.ResizeTo(500, 3);
+      for (Int_t i = 0; i < fEvents.GetNrows(); ++i) {
+         for (Int_t j = 0; j < fEvents.GetNcols(); ++j) {
+            fEvents(i, j) = rng.Gaus(0, 1.5);
+         }
+      }
+   };
+
+   MethodBDT *Train(TString title, TString options)
+   {
+      IMethod *m = fFactory->BookMethod(fDataLoader.get(), Types::kBDT, title, "!H:!V:NTrees=20:" + options);
+      fFactory->TrainAllMethods();
+      return dynamic_cast<MethodBDT *>(m);
+   };
+
+   // the same boost weights and MVA values, bit by bit
+   void Verify(MethodBDT *serial, MethodBDT *parallel)
+   {
+      ASSERT_NE(serial, nullptr);
+      ASSERT_NE(parallel, nullptr);
+      ASSERT_EQ(serial->GetForest().size(), parallel->GetForest().size());
+      EXPECT_EQ(serial->GetBoostWeights(), parallel->GetBoostWeights());
+      EXPECT_EQ(serial->GetMvaValues(fEvents), parallel->GetMvaValues(fEvents));
+   };
+
+private:
+   std::unique_ptr<TMVA::Factory> fFactory;
+   std::shared_ptr<TMVA::DataLoader> fDataLoader;
+   TMatrixF fEvents;
+};
+
+} // End namespace TMVA
+
+// A context, and so a factory, for each training: the second one would
+// otherwise train the methods of the first one again
+static void TrainAndVerify(TString title, TString options)
+{
+   TMVA::TestMethodBDTImplicitMT serialContext, parallelContext;
+   ROOT::DisableImplicitMT();
+   TMVA::MethodBDT *serial = serialContext.Train(title + "Serial", options);
+   ROOT::EnableImplicitMT();
+   TMVA::MethodBDT *parallel = parallelContext.Train(title + "Parallel", options);
+   ROOT::DisableImplicitMT();
+   serialContext.Verify(serial, parallel);
+}
+
+TEST(MethodBDTImplicitMT, AdaBoost)
+{
+   TrainAndVerify("BDTAda", "BoostType=AdaBoost:MaxDepth=3");
+}
+
+TEST(MethodBDTImplicitMT, GradBoost)
+{
+   TrainAndVerify("BDTG", "BoostType=Grad:Shrinkage=0.1:MaxDepth=4");
+}
+
+#endif // R__USE_IMT
@@ -0,0 +1,46 @@
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TCOMPRESSION_POLICY
+#define ROOT_TCOMPRESSION_POLICY
+
+#include "RtypesCore.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class TCompressionPolicy {
+public:
+   TCompressionPolicy() {}
+
+   void AddCandidate(Int_t settings);
+   void AddRule(const std::string &pattern, Int_t settings);
+   void Evaluate(const char *buffer, Int_t len, std::vector<Double_t> &costs) const;
+   Int_t FindRule(const char *branchname) const;
+   Int_t GetBestCandidate(const std::vector<Double_t> &costs) const;
+   Int_t GetCalibrationBaskets() const { return fCalibrationBaskets; }
+   const std::vector<Int_t> &GetCandidates() const;
+   Double_t GetTimeWeight() const { return fTimeWeight; }
+   void Print() const;
+   void SetCalibration(Int_t nbaskets, Double_t timeWeight = 0.1);
+
+private:
+   std::vector<std::pair<std::string, Int_t>> fRules; ///< Wildcard branch name patterns and their compression settings
+   std::vector<Int_t> fCandidates;                     ///< Compression settings tried during the calibration
+   Int_t fCalibrationBaskets{0};                       ///< Number of baskets per branch used for the calibration
+   Double_t fTimeWeight{0.1};                          ///< Weight of the relative decompression time versus the compression ratio
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif // ROOT_TCOMPRESSION_POLICY
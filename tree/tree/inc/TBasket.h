@@ -27,6 +27,8 @@
 
 #include "TKey.h"
 
+#include <memory>
+
 class TFile;
 class TTree;
 class TBranch;
@@ -40,6 +42,10 @@ private:
    // Internal corner cases for ReadBasketBuffers
    Int_t ReadBasketBuffersUnzip(char*, Int_t, Bool_t, TFile*);
    Int_t ReadBasketBuffersUncompressedCase();
+   Int_t ReadBasketBuffersMapped(const std::shared_ptr<char>&, Int_t, TFile*);
+
+   // Give back a private copy of the buffer if it points into a memory mapped file.
+   void ReleaseMappedBuffer(Bool_t copy = kTRUE);
 
    // Helper for managing the compressed buffer.
    void InitializeCompressedBuffer(Int_t len, TFile* file);
@@ -62,6 +68,7 @@ protected:
    UChar_t     fIOBits{0};                    ///<!IO feature flags.  Serialized in custom portion of streamer to avoid forward compat issues unless needed.
    Bool_t      fOwnsCompressedBuffer{kFALSE}; ///<! Whether or not we own the compressed buffer.
    Bool_t      fReadEntryOffset{kFALSE};      ///<!Set to true if offset array was read from a file.
+   std::shared_ptr<char> fMappedBuffer;       ///<!Read-only memory mapped file pages wrapped by fBufferRef (if any); keeps them mapped.
    Int_t      *fDisplacement{nullptr};        ///<![fNevBuf] Displacement of entries in fBuffer(TKey)
    Int_t      *fEntryOffset{nullptr};         ///<[fNevBuf] Offset of entries in fBuffer(TKey); generated at runtime.  Special value
                                               /// of `-1` indicates that the offset generation MUST be performed on first read.
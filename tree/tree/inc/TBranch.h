@@ -24,6 +24,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <memory>
+#include <vector>
 
 #include "TNamed.h"
 
@@ -62,6 +63,7 @@ class TBranch : public TNamed , public TAttFill {
 protected:
    friend class TTreeCloner;
    friend class TTree;
+   friend class TBasket;
 
    // TBranch status bits
    enum EStatusBits {
@@ -114,6 +116,9 @@ protected:
 
    Bool_t      fSkipZip;          ///<! After being read, the buffer will not be unzipped.
 
+   Int_t       fNCompressCalibrated{0}; ///<! Number of baskets evaluated by the tree compression policy (-1 when done)
+   std::vector<Double_t> fCompressCosts; ///<! Accumulated cost of each compression policy candidate
+
    typedef void (TBranch::*ReadLeaves_t)(TBuffer &b);
    ReadLeaves_t fReadLeaves;      ///<! Pointer to the ReadLeaves implementation to use.
    typedef void (TBranch::*FillLeaves_t)(TBuffer &b);
@@ -125,6 +130,7 @@ protected:
    void     FillLeavesImpl(TBuffer &b);
 
    void     SetSkipZip(Bool_t skip = kTRUE) { fSkipZip = skip; }
+   void     UpdateCompressionFromPolicy(const char *buffer, Int_t len);
    void     Init(const char *name, const char *leaflist, Int_t compress);
 
    TBasket *GetFreshBasket();
@@ -170,6 +176,8 @@ public:
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
    TDirectory       *GetDirectory() const {return fDirectory;}
+           Int_t     GetBulkEntries(Long64_t entry, TBuffer &user_buf);
+           Int_t     GetEntriesSerialized(Long64_t entry, TBuffer &user_buf);
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
            Int_t     GetEntryOffsetLen() const { return fEntryOffsetLen; }
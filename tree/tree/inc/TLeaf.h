@@ -100,6 +100,9 @@ public:
    virtual void     PrintValue(Int_t i = 0) const;
    virtual void     ReadBasket(TBuffer &) {}
    virtual void     ReadBasketExport(TBuffer &, TClonesArray *, Int_t) {}
+   /// Convert in place N consecutive serialized entries of this leaf, starting at the current position
+   /// of the buffer, to their in-memory representation. Return kFALSE if the leaf does not support it.
+   virtual Bool_t   ReadBasketFast(TBuffer &, Long64_t) { return kFALSE; }
    virtual void     ReadValue(std::istream & /*s*/, Char_t /*delim*/ = ' ') {
       Error("ReadValue", "Not implemented!");
    }
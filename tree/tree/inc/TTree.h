@@ -26,6 +26,7 @@
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
+#include "ROOT/TCompressionPolicy.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "TArrayD.h"
 #include "TArrayI.h"
@@ -139,6 +140,7 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   std::unique_ptr<ROOT::Experimental::TCompressionPolicy> fCompressionPolicy; ///<! Per-branch compression settings selection, if any
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
@@ -374,6 +376,7 @@ public:
    virtual Long64_t        GetChainEntryNumber(Long64_t entry) const { return entry; }
    virtual Long64_t        GetChainOffset() const { return fChainOffset; }
    virtual Bool_t          GetClusterPrefetch() const { return fCacheDoClusterPrefetch; }
+   const ROOT::Experimental::TCompressionPolicy *GetCompressionPolicy() const { return fCompressionPolicy.get(); }
    TFile                  *GetCurrentFile() const;
            Int_t           GetDefaultEntryOffsetLen() const {return fDefaultEntryOffsetLen;}
            Long64_t        GetDebugMax()  const { return fDebugMax; }
@@ -530,6 +533,8 @@ public:
    virtual void            SetChainOffset(Long64_t offset = 0) { fChainOffset=offset; }
    virtual void            SetCircular(Long64_t maxEntries);
    virtual void            SetClusterPrefetch(Bool_t enabled) { fCacheDoClusterPrefetch = enabled; }
+           void            SetCompressionPolicy(const ROOT::Experimental::TCompressionPolicy &policy);
+           void            ResetCompressionPolicy();
    virtual void            SetDebug(Int_t level = 1, Long64_t min = 0, Long64_t max = 9999999); // *MENU*
    virtual void            SetDefaultEntryOffsetLen(Int_t newdefault, Bool_t updateExisting = kFALSE);
    virtual void            SetDirectory(TDirectory* dir);
@@ -63,6 +63,7 @@ protected:
    Bool_t       fReadDirectionSet{kFALSE}; ///<! read direction established
    Bool_t       fEnabled{kTRUE};      ///<! cache enabled for cached reading
    EPrefillType fPrefillType;         ///<  Whether a pre-filling is enabled (and if applicable which type)
+   Int_t        fPrefetchDepth{1};    ///<! Minimum number of clusters read ahead by each asynchronous prefetch
    static Int_t fgLearnEntries;       ///<  number of entries used for learning mode
    Bool_t       fAutoCreated{kFALSE}; ///<! true if cache was automatically created
 
@@ -137,6 +138,7 @@ public:
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
+   Int_t                GetConfiguredPrefetchDepth() const;
    Double_t             GetEfficiency() const;
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
@@ -145,6 +147,7 @@ public:
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
+   Int_t                GetPrefetchDepth() const {return fPrefetchDepth;}
    TTree               *GetTree() const {return fTree;}
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
@@ -166,6 +169,7 @@ public:
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(Bool_t opt);
+   void                 SetPrefetchDepth(Int_t nclusters = 1);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
    virtual void         UpdateBranches(TTree *tree);
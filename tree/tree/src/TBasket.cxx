@@ -120,6 +120,7 @@ TBasket::~TBasket()
 
 void TBasket::AdjustSize(Int_t newsize)
 {
+   ReleaseMappedBuffer();
    if (fBuffer == fBufferRef->Buffer()) {
       fBufferRef->Expand(newsize);
       fBuffer = fBufferRef->Buffer();
@@ -135,6 +136,7 @@ void TBasket::AdjustSize(Int_t newsize)
 
 Long64_t TBasket::CopyTo(TFile *to)
 {
+   ReleaseMappedBuffer();
    fBufferRef->SetWriteMode();
    Int_t nout = fNbytes - fKeylen;
    fBuffer = fBufferRef->Buffer();
@@ -169,6 +171,7 @@ Int_t TBasket::DropBuffers()
    if (fBufferRef)    delete fBufferRef;
    if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
    fBufferRef   = 0;
+   fMappedBuffer.reset();
    fCompressedBufferRef = 0;
    fBuffer      = 0;
    fDisplacement= 0;
@@ -234,6 +237,7 @@ Int_t TBasket::GetEntryPointer(Int_t entry)
 
 Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree)
 {
+   ReleaseMappedBuffer(kFALSE);
    if (fBufferRef) {
       // Reuse the buffer if it exist.
       fBufferRef->Reset();
@@ -394,6 +398,64 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
    return fObjlen+fKeylen;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// We are in the case where the basket is not compressed and its bytes are
+/// available in the memory mapped file: wrap the mapped pages in fBufferRef
+/// instead of reading and copying them.
+/// Returns the length of the basket or -1 in case of error; 0 is returned
+/// if the basket turns out to be compressed and must be read the usual way.
+
+Int_t TBasket::ReadBasketBuffersMapped(const std::shared_ptr<char> &mapped, Int_t size, TFile *file)
+{
+   char *buffer = mapped.get();
+   if (fBufferRef) {
+      fBufferRef->SetBuffer(buffer, size, kFALSE);
+      fBufferRef->SetReadMode();
+      fBufferRef->Reset();
+   } else {
+      fBufferRef = new TBufferFile(TBuffer::kRead, size, buffer, kFALSE);
+   }
+   fMappedBuffer = mapped;
+   fBufferRef->SetParent(file);
+
+   Streamer(*fBufferRef);
+
+   if (IsZombie()) {
+      return -1;
+   }
+   if (fObjlen + fKeylen != fNbytes) {
+      // Somehow the basket was compressed anyway.
+      return 0;
+   }
+
+   fBuffer = fBufferRef->Buffer();
+   return fObjlen+fKeylen;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// If fBufferRef wraps read-only memory mapped pages, replace them by a
+/// buffer owned by the basket, copying the content if requested.
+
+void TBasket::ReleaseMappedBuffer(Bool_t copy /* = kTRUE */)
+{
+   if (R__likely(!fMappedBuffer)) return;
+   if (!fBufferRef) {
+      fMappedBuffer.reset();
+      return;
+   }
+
+   Int_t size = fBufferRef->BufferSize();
+   Int_t offset = fBufferRef->Length();
+   Bool_t useBuffer = (fBuffer == fBufferRef->Buffer());
+   char *buffer = new char[size];
+   if (copy) memcpy(buffer, fBufferRef->Buffer(), size);
+   fBufferRef->SetBuffer(buffer, size, kTRUE);
+   fBufferRef->SetBufferOffset(offset);
+   if (useBuffer) fBuffer = buffer;
+   // Only now that nothing points into them the pages can be released.
+   fMappedBuffer.reset();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize a buffer for reading if it is not already initialized
 
@@ -460,9 +522,28 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   TFileCacheRead *pf = nullptr;
+
+   // If the basket is not compressed and the file is memory mapped,
+   // use the mapped pages directly.
+   if (R__unlikely(fBranch->GetCompressionLevel()==0) && file->IsMemoryMapped()) {
+      std::shared_ptr<char> mapped;
+      {
+         R__LOCKGUARD_IMT2(gROOTMutex); // Lock for parallel TTree I/O
+         mapped = file->GetMappedBuffer(pos, len);
+      }
+      if (mapped) {
+         Int_t res = ReadBasketBuffersMapped(mapped, len, file);
+         if (res < 0) return 1;
+         if (res > 0) {
+            len = res;
+            goto AfterBuffer;
+         }
+      }
+   }
+   ReleaseMappedBuffer(kFALSE);
 
    // See if the cache has already unzipped the buffer for us.
-   TFileCacheRead *pf = nullptr;
    {
       R__LOCKGUARD_IMT2(gROOTMutex); // Lock for parallel TTree I/O
       pf = file->GetCacheRead(fBranch->GetTree());
@@ -703,6 +784,8 @@ void TBasket::Reset()
    // Name, Title, fClassName, fBranch
    // stay the same.
 
+   ReleaseMappedBuffer(kFALSE);
+
    // Downsize the buffer if needed.
    Int_t curSize = fBufferRef->BufferSize();
    // fBufferLen at this point is already reset, so use indirect measurements
@@ -791,6 +874,7 @@ void TBasket::SetReadMode()
 
 void TBasket::SetWriteMode()
 {
+   ReleaseMappedBuffer();
    fBufferRef->SetWriteMode();
    fBufferRef->SetBufferOffset(fLast);
 }
@@ -1068,6 +1152,9 @@ Int_t TBasket::WriteBuffer()
 
    fHeaderOnly = kTRUE;
    fCycle = fBranch->GetWriteBasket();
+   if (fBranch->GetTree()->GetCompressionPolicy()) {
+      fBranch->UpdateCompressionFromPolicy(fBufferRef->Buffer() + fKeylen, fObjlen);
+   }
    Int_t cxlevel = fBranch->GetCompressionLevel();
    ROOT::ECompressionAlgorithm cxAlgorithm = static_cast<ROOT::ECompressionAlgorithm>(fBranch->GetCompressionAlgorithm());
    if (cxlevel > 0) {
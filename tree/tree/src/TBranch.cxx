@@ -42,6 +42,7 @@
 
 #include "TBranchIMTHelper.h"
 
+#include "ROOT/TCompressionPolicy.hxx"
 #include "ROOT/TIOFeatures.hxx"
 
 #include <atomic>
@@ -1222,6 +1223,119 @@ const char* TBranch::GetIconName() const
       return "TBranchElement-leaf";
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read, in their on-file (serialized, big-endian) representation, all the
+/// entries from `entry` up to the end of the basket containing it.
+///
+/// The values are copied contiguously at the beginning of `user_buf`, which is
+/// expanded if needed; its current offset is reset to 0.
+/// This is only supported for branches with a single leaf of fixed size
+/// (fundamental type or fixed-length array of a fundamental type).
+///
+/// The function returns the number of entries stored in `user_buf`, 0 if `entry`
+/// does not exist and -1 in case of error.
+///
+/// See also GetBulkEntries, which additionally converts the values to their
+/// in-memory representation.
+
+Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf)
+{
+   if (R__unlikely(fNleaves != 1 || IsA() != TBranch::Class())) {
+      Error("GetEntriesSerialized", "Branch %s is not a simple branch with a single leaf", GetName());
+      return -1;
+   }
+   TLeaf *leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   if (R__unlikely(leaf->GetLeafCount())) {
+      Error("GetEntriesSerialized", "Leaf %s of branch %s has a variable length", leaf->GetName(), GetName());
+      return -1;
+   }
+   if ((entry < fFirstEntry) || (entry >= fEntryNumber)) {
+      return 0;
+   }
+
+   fReadEntry = entry;
+   if (!fCurrentBasket || entry < fFirstBasketEntry || entry >= fNextBasketEntry) {
+      fReadBasket = TMath::BinarySearch(fWriteBasket + 1, fBasketEntry, entry);
+      if (fReadBasket < 0) {
+         fNextBasketEntry = -1;
+         Error("GetEntriesSerialized", "In the branch %s, no basket contains the entry %lld\n", GetName(), entry);
+         return -1;
+      }
+      if (fReadBasket == fWriteBasket) {
+         fNextBasketEntry = fEntryNumber;
+      } else {
+         fNextBasketEntry = fBasketEntry[fReadBasket+1];
+      }
+      fFirstBasketEntry = fBasketEntry[fReadBasket];
+      fCurrentBasket = GetBasket(fReadBasket);
+      if (!fCurrentBasket) {
+         fFirstBasketEntry = -1;
+         fNextBasketEntry = -1;
+         return -1;
+      }
+   }
+   TBasket *basket = fCurrentBasket;
+   basket->PrepareBasket(entry);
+   TBuffer *buf = basket->GetBufferRef();
+   if (R__unlikely(!buf)) {
+      return -1;
+   }
+   if (R__unlikely(!buf->IsReading())) {
+      basket->SetReadMode();
+   }
+
+   Int_t entrySize = leaf->GetLenType() * leaf->GetLenStatic();
+   if (R__unlikely(basket->GetEntryOffset() || basket->GetNevBufSize() != entrySize)) {
+      Error("GetEntriesSerialized", "Basket %d of branch %s does not hold fixed size entries", fReadBasket, GetName());
+      return -1;
+   }
+
+   Int_t nentries = fFirstBasketEntry + basket->GetNevBuf() - entry;
+   Int_t nbytes = nentries * entrySize;
+   if (user_buf.BufferSize() < nbytes) {
+      user_buf.Expand(nbytes, kFALSE);
+   }
+   memcpy(user_buf.Buffer(), buf->Buffer() + basket->GetKeylen() + (entry - fFirstBasketEntry) * entrySize, nbytes);
+   user_buf.SetBufferOffset(0);
+   return nentries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries from `entry` up to the end of the basket containing it,
+/// as a contiguous array of values in their in-memory representation.
+///
+/// This bypasses the per-entry TLeaf::ReadBasket calls: the values of a whole
+/// basket are copied and byte-swapped in one go, e.g.
+///
+///~~~ {.cpp}
+///     TBufferFile buf(TBuffer::kWrite, 10000);
+///     Long64_t entry = 0;
+///     while (Int_t n = branch->GetBulkEntries(entry, buf)) {
+///        if (n < 0) break; // error
+///        const Float_t *values = reinterpret_cast<Float_t *>(buf.Buffer());
+///        for (Int_t i = 0; i < n; ++i) sum += values[i];
+///        entry += n;
+///     }
+///~~~
+///
+/// For a fixed-length array leaf, each entry holds GetLenStatic() values.
+/// Same return value and restrictions as GetEntriesSerialized; additionally the
+/// leaf type must support TLeaf::ReadBasketFast.
+
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
+{
+   Int_t nentries = GetEntriesSerialized(entry, user_buf);
+   if (nentries <= 0) {
+      return nentries;
+   }
+   TLeaf *leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   if (R__unlikely(!leaf->ReadBasketFast(user_buf, nentries))) {
+      Error("GetBulkEntries", "Leaf %s of branch %s does not support bulk reading", leaf->GetName(), GetName());
+      return -1;
+   }
+   return nentries;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read all leaves of entry and return total number of bytes read.
 ///
@@ -2776,6 +2890,41 @@ void TBranch::SetupAddresses()
    // Nothing to do for regular branch, the TLeaf already did it.
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Apply the tree's compression policy (see ROOT::Experimental::TCompressionPolicy)
+/// before the basket holding `buffer` (`len` uncompressed bytes) is compressed.
+///
+/// A matching rule fixes the compression settings of this branch. Otherwise the
+/// buffer is used to calibrate the candidate settings; once enough baskets have
+/// been sampled, the best candidate becomes the branch's compression settings.
+/// Sub-branches are calibrated independently.
+
+void TBranch::UpdateCompressionFromPolicy(const char *buffer, Int_t len)
+{
+   if (fNCompressCalibrated < 0) return;
+   const ROOT::Experimental::TCompressionPolicy *policy = fTree->GetCompressionPolicy();
+   if (!policy) return;
+
+   Int_t settings = policy->FindRule(GetName());
+   if (settings >= 0) {
+      fCompress = settings;
+      fNCompressCalibrated = -1;
+      return;
+   }
+   if (policy->GetCalibrationBaskets() <= 0) {
+      fNCompressCalibrated = -1;
+      return;
+   }
+
+   policy->Evaluate(buffer, len, fCompressCosts);
+   if (++fNCompressCalibrated >= policy->GetCalibrationBaskets()) {
+      fCompress = policy->GetBestCandidate(fCompressCosts);
+      fNCompressCalibrated = -1;
+      fCompressCosts.clear();
+      fCompressCosts.shrink_to_fit();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Refresh the value of fDirectory (i.e. where this branch writes/reads its buffers)
 /// with the current value of fTree->GetCurrentFile unless this branch has been
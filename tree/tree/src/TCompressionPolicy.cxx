@@ -0,0 +1,219 @@
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TCompressionPolicy.hxx"
+#include "Compression.h"
+#include "RZip.h"
+#include "TError.h"
+#include "TRegexp.h"
+#include "TString.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+using namespace ROOT::Experimental;
+
+/**
+ * \class ROOT::Experimental::TCompressionPolicy
+ * \ingroup tree
+ *
+ * `TCompressionPolicy` selects the compression settings (algorithm and level) of
+ * each branch of a `TTree` being written.
+ *
+ * Two mechanisms are available:
+ *  - Rules: branches whose name matches a wildcard pattern are given fixed
+ *    compression settings (e.g. LZ4 for hot kinematic branches, LZMA for
+ *    rarely read provenance branches). The first matching rule wins.
+ *  - Calibration: the first baskets written for each branch not matched by
+ *    a rule are compressed and decompressed with every candidate setting.
+ *    The candidate with the lowest cost, summed over these baskets, is used
+ *    for the following baskets of the branch. The cost of a candidate for a
+ *    basket is
+ *    `compressed size / uncompressed size + timeWeight * decompression time / largest decompression time`,
+ *    where the largest decompression time is the one of the slowest candidate
+ *    for the same basket. Both terms are thus between 0 and 1: with the default
+ *    `timeWeight` of 0.1, a candidate which decompresses as slowly as the
+ *    slowest one is chosen over a candidate with negligible decompression time
+ *    only if it saves more than 10% of the uncompressed size. Baskets that do
+ *    not compress (e.g. random bits) end up uncompressed.
+ *
+ * The decompression times are wall-clock measurements: for `timeWeight` > 0,
+ * the choice between candidates with similar costs depends on the machine and
+ * on its load while the tree is written, and may differ between two runs. Use
+ * a `timeWeight` of 0 (smallest output) or rules for a reproducible choice.
+ *
+ * Example usage:
+ * ~~~{.cpp}
+ * ROOT::Experimental::TCompressionPolicy policy;
+ * policy.AddRule("provenance*", ROOT::CompressionSettings(ROOT::kLZMA, 8));
+ * policy.AddRule("jet_*", ROOT::CompressionSettings(ROOT::kLZ4, 4));
+ * policy.SetCalibration(2); // use the first two baskets of the other branches
+ * tree.SetCompressionPolicy(policy);
+ * ~~~
+ *
+ * The method `TTree::SetCompressionPolicy` creates a copy of the policy; subsequent changes
+ * to the `TCompressionPolicy` object do not propagate to the `TTree`.
+ */
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Add a compression setting to try during the calibration.
+/// \param[in] settings The compression settings, as given by `ROOT::CompressionSettings`.
+///
+/// If no candidate is added, uncompressed, LZ4, ZLIB and LZMA are tried.
+void TCompressionPolicy::AddCandidate(Int_t settings)
+{
+   if (settings < 0) {
+      Error("AddCandidate", "Invalid compression settings %d", settings);
+      return;
+   }
+   fCandidates.push_back(settings);
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Use fixed compression settings for the branches matching a pattern.
+/// \param[in] pattern Wildcard expression (see `TRegexp`) matched against the branch name.
+/// \param[in] settings The compression settings, as given by `ROOT::CompressionSettings`.
+void TCompressionPolicy::AddRule(const std::string &pattern, Int_t settings)
+{
+   if (settings < 0) {
+      Error("AddRule", "Invalid compression settings %d for pattern %s", settings, pattern.c_str());
+      return;
+   }
+   fRules.emplace_back(pattern, settings);
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Accumulate the cost of each candidate setting for a buffer.
+/// \param[in] buffer The uncompressed data.
+/// \param[in] len The length of the uncompressed data.
+/// \param[in,out] costs The accumulated costs, one per candidate (see `GetCandidates`).
+void TCompressionPolicy::Evaluate(const char *buffer, Int_t len, std::vector<Double_t> &costs) const
+{
+   const auto &candidates = GetCandidates();
+   costs.resize(candidates.size(), 0.);
+   if (len <= 0) return;
+
+   // Size ratio and decompression time of each candidate for this buffer
+   std::vector<Double_t> ratios(candidates.size(), 1.);
+   std::vector<Double_t> times(candidates.size(), 0.);
+
+   const Int_t nbuffers = 1 + (len - 1) / kMAXZIPBUF;
+   std::unique_ptr<char[]> zipped(new char[len + 9 * nbuffers + 28]);
+   std::unique_ptr<char[]> unzipped(new char[len]);
+
+   for (size_t c = 0; c < candidates.size(); ++c) {
+      const Int_t level = candidates[c] % 100;
+      const auto algorithm = static_cast<ROOT::ECompressionAlgorithm>(candidates[c] / 100);
+      Int_t nzip = 0;
+      Int_t noutot = 0;
+      Bool_t compressed = level > 0;
+      char *src = const_cast<char *>(buffer);
+      char *tgt = zipped.get();
+      for (Int_t i = 0; compressed && i < nbuffers; ++i) {
+         Int_t bufmax = (i == nbuffers - 1) ? len - nzip : kMAXZIPBUF;
+         Int_t nout = 0;
+         R__zipMultipleAlgorithm(level, &bufmax, src, &bufmax, tgt, &nout, algorithm);
+         // Same criterion as TBasket::WriteBuffer: the buffer is then written uncompressed.
+         if (nout == 0 || nout >= len) compressed = kFALSE;
+         noutot += nout;
+         nzip += kMAXZIPBUF;
+         src += kMAXZIPBUF;
+         tgt += nout;
+      }
+      if (!compressed) continue;
+
+      auto start = std::chrono::steady_clock::now();
+      UChar_t *bufcur = reinterpret_cast<UChar_t *>(zipped.get());
+      UChar_t *objbuf = reinterpret_cast<UChar_t *>(unzipped.get());
+      Int_t nunzip = 0;
+      while (nunzip < len) {
+         Int_t nin, nbuf, nout = 0;
+         if (R__unzip_header(&nin, bufcur, &nbuf) != 0) break;
+         R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
+         if (!nout) break;
+         nunzip += nout;
+         bufcur += nin;
+         objbuf += nout;
+      }
+      auto stop = std::chrono::steady_clock::now();
+
+      ratios[c] = Double_t(noutot) / len;
+      times[c] = std::chrono::duration<Double_t>(stop - start).count();
+   }
+
+   // The times are normalized to the slowest candidate, to be on the same scale as the ratios.
+   const Double_t maxTime = *std::max_element(times.begin(), times.end());
+   for (size_t c = 0; c < candidates.size(); ++c) {
+      costs[c] += ratios[c];
+      if (maxTime > 0) costs[c] += fTimeWeight * times[c] / maxTime;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the compression settings of the first rule matching the branch name,
+/// or -1 if none matches.
+Int_t TCompressionPolicy::FindRule(const char *branchname) const
+{
+   TString name(branchname);
+   for (const auto &rule : fRules) {
+      TRegexp re(rule.first.c_str(), kTRUE);
+      if (name.Index(re) != kNPOS) return rule.second;
+   }
+   return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the candidate compression settings with the lowest accumulated cost.
+Int_t TCompressionPolicy::GetBestCandidate(const std::vector<Double_t> &costs) const
+{
+   const auto &candidates = GetCandidates();
+   size_t best = 0;
+   for (size_t c = 1; c < costs.size() && c < candidates.size(); ++c) {
+      if (costs[c] < costs[best]) best = c;
+   }
+   return candidates[best];
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the compression settings tried during the calibration.
+const std::vector<Int_t> &TCompressionPolicy::GetCandidates() const
+{
+   static const std::vector<Int_t> defaultCandidates{0, ROOT::CompressionSettings(ROOT::kLZ4, 4),
+                                                     ROOT::CompressionSettings(ROOT::kZLIB, 1),
+                                                     ROOT::CompressionSettings(ROOT::kLZMA, 5)};
+   return fCandidates.empty() ? defaultCandidates : fCandidates;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Print a human-readable representation of the policy to stdout.
+void TCompressionPolicy::Print() const
+{
+   for (const auto &rule : fRules) {
+      printf("Rule: %s -> %d\n", rule.first.c_str(), rule.second);
+   }
+   if (fCalibrationBaskets > 0) {
+      printf("Calibration on %d basket(s), time weight %g, candidates:", fCalibrationBaskets, fTimeWeight);
+      for (auto settings : GetCandidates()) printf(" %d", settings);
+      printf("\n");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Enable the calibration of the branches not matched by a rule.
+/// \param[in] nbaskets Number of baskets per branch to sample; 0 disables the calibration.
+/// \param[in] timeWeight Weight of the decompression time, relative to the one of the slowest
+///            candidate, versus the compression ratio (see the class documentation).
+///            0 selects the smallest output; larger values favour faster decompression:
+///            with 1, the size and the decompression time weigh the same.
+void TCompressionPolicy::SetCalibration(Int_t nbaskets, Double_t timeWeight)
+{
+   fCalibrationBaskets = nbaskets < 0 ? 0 : nbaskets;
+   fTimeWeight = timeWeight < 0 ? 0 : timeWeight;
+}
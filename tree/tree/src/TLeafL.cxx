@@ -177,6 +177,23 @@ void TLeafL::ReadBasket(TBuffer &b)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize in place N entries of this leaf in input_buf, starting at its
+/// current position (see TBranch::GetBulkEntries).
+
+Bool_t TLeafL::ReadBasketFast(TBuffer &input_buf, Long64_t N)
+{
+   if (R__unlikely(fLeafCount)) return kFALSE;
+
+#ifdef R__BYTESWAP
+   // Convert the values in place; without byte swapping they are already in memory order
+   Int_t pos = input_buf.Length();
+   input_buf.ReadFastArray(reinterpret_cast<Long64_t*>(input_buf.Buffer() + pos), fLen*N);
+   input_buf.SetBufferOffset(pos);
+#endif
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
@@ -136,6 +136,15 @@ void TLeafO::ReadBasket(TBuffer &b)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize in place N entries of this leaf in input_buf, starting at its
+/// current position (see TBranch::GetBulkEntries). Single byte values need no conversion.
+
+Bool_t TLeafO::ReadBasketFast(TBuffer &, Long64_t)
+{
+   return !fLeafCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaf elements from Basket input buffer and export buffer to
 /// TClonesArray objects.
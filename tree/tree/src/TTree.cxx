@@ -4336,6 +4336,23 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Multi-threaded processing
+///
+/// When implicit multi-threading is enabled (see ROOT::EnableImplicitMT),
+/// TTree::Draw processes the entries in parallel, once the first
+/// fEstimate values are filled (this is when the limits of the
+/// histogram are computed). The tasks run on the clusters of the tree
+/// (see ROOT::TTreeProcessorMT), each with its own copy of the variables and
+/// of the selection. This applies to 1-D, 2-D and 3-D histograms, profiles
+/// and 2-D profiles (not to the graphs drawn for scatter plots), and to
+/// TEventList and TEntryList objects. The tree, and its friends, must be read
+/// from files (a TChain must have TChain friends), without an input event or
+/// entry list, and the variables must be numbers; neither the variables nor
+/// the selection may call interpreted functions or methods. Otherwise, and when the
+/// number of selected rows is not greater than fEstimate, the entries are
+/// processed sequentially. The arrays returned by GetV1(), etc. only hold the
+/// values computed before the parallel processing started.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -8492,6 +8509,36 @@ void TTree::SetCircular(Long64_t maxEntries)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Select the compression settings of each branch when its baskets are written
+/// (see ROOT::Experimental::TCompressionPolicy).
+///
+/// The policy is copied. Branches matching one of its rules get the rule's
+/// compression settings; if a calibration is requested, the other branches get
+/// the settings that performed best on their first baskets. The settings chosen
+/// are stored with each branch, so reading the tree back does not need the policy.
+
+void TTree::SetCompressionPolicy(const ROOT::Experimental::TCompressionPolicy &policy)
+{
+   fCompressionPolicy.reset(new ROOT::Experimental::TCompressionPolicy(policy));
+   TIter next(GetListOfLeaves());
+   TLeaf *leaf;
+   while ((leaf = (TLeaf*)next())) {
+      TBranch *branch = leaf->GetBranch();
+      branch->fNCompressCalibrated = 0;
+      branch->fCompressCosts.clear();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop applying the compression policy; the branches keep the compression
+/// settings selected so far.
+
+void TTree::ResetCompressionPolicy()
+{
+   fCompressionPolicy.reset();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the debug level and the debug range.
 ///
@@ -72,6 +72,15 @@ for the miss cache and find the correct basket.  This can be potentially a
 CPU-expensive operation compared to, e.g., the latency of a SSD.  This is why
 the miss cache is currently disabled by default.
 
+When asynchronous prefetching is enabled (see TFileCacheRead::SetEnablePrefetching
+or the TFile.AsyncPrefetching option), the cache is double buffered: while
+the entries of one block of clusters are processed, the baskets of the following
+block are read in the background by TFilePrefetch with a single vectored read.
+By default each block holds as many clusters as fit in the cache size; the
+minimum number of clusters read ahead in each block can be raised with
+TTreeCache::SetPrefetchDepth (or the TTreeCache.PrefetchDepth option) to hide
+the latency of remote or slow storage behind longer processing times.
+
 ## WHY DO WE NEED the TreeCache when doing data analysis?
 
 When writing a TTree, the branch buffers are kept in memory.
@@ -265,7 +274,8 @@ ClassImp(TTreeCache);
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
-TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType())
+TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillType()),
+   fPrefetchDepth(GetConfiguredPrefetchDepth())
 {
 }
 
@@ -274,7 +284,8 @@ TTreeCache::TTreeCache() : TFileCacheRead(), fPrefillType(GetConfiguredPrefillTy
 
 TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    : TFileCacheRead(tree->GetCurrentFile(), buffersize, tree), fEntryMax(tree->GetEntriesFast()), fEntryNext(0),
-     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType())
+     fBrNames(new TList), fTree(tree), fPrefillType(GetConfiguredPrefillType()),
+     fPrefetchDepth(GetConfiguredPrefetchDepth())
 {
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntries();
@@ -1004,6 +1015,9 @@ Bool_t TTreeCache::FillBuffer()
       fNtotCurrentBuf = fNtot;
    }
 
+   // In prefetching mode, read ahead at least fPrefetchDepth clusters in each block.
+   const Int_t minClusters = (fEnablePrefetching && !fIsLearning) ? fPrefetchDepth : 1;
+
    //store baskets
    Int_t clusterIterations = 0;
    Long64_t minEntry = fEntryCurrent;
@@ -1023,6 +1037,8 @@ Bool_t TTreeCache::FillBuffer()
             TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
             if (b->GetDirectory()==0) continue;
             if (b->GetDirectory()->GetFile() != fFile) continue;
+            // Uncompressed baskets are read directly from the memory mapped file.
+            if (fFile->IsMemoryMapped() && b->GetCompressionLevel() == 0) continue;
             Int_t nb = b->GetMaxBaskets();
             Int_t *lbaskets   = b->GetBasketBytes();
             Long64_t *entries = b->GetBasketEntry();
@@ -1060,7 +1076,10 @@ Bool_t TTreeCache::FillBuffer()
 
                if ( (fNtotCurrentBuf+len) > fBufferSizeMin ) {
                   // Humm ... we are going to go over the requested size.
-                  if (clusterIterations > 0) {
+                  if (clusterIterations > 0 && clusterIterations < minClusters) {
+                     // We have not yet read ahead enough clusters, keep going even
+                     // if this exceeds the requested size.
+                  } else if (clusterIterations > 0) {
                      // We already have a full cluster and now we would go over the requested
                      // size, let's stop caching (and make sure we start next time from the
                      // end of the previous cluster).
@@ -1113,7 +1132,8 @@ Bool_t TTreeCache::FillBuffer()
                if ( ( j < (nb-1) ) && entries[j+1] > maxReadEntry ) {
                   maxReadEntry = entries[j+1];
                }
-               if (fNtotCurrentBuf > 4*fBufferSizeMin) {
+               // A block of minClusters clusters is expected to exceed the cache size
+               if (fNtotCurrentBuf > 4*(Long64_t)minClusters*fBufferSizeMin) {
                   // Humm something wrong happened.
                   Warning("FillBuffer","There is more data in this cluster (starting at entry %lld to %lld, current=%lld) than usual ... with %d %.3f%% of the branches we already have %d bytes (instead of %d)",
                           fEntryCurrent,fEntryNext, entries[j], i, (100.0*i) / ((float)fNbranches), fNtotCurrentBuf,fBufferSizeMin);
@@ -1145,7 +1165,8 @@ Bool_t TTreeCache::FillBuffer()
       // would be if we run the loop one more time.   fNtotCurrentBuf and clusterIterations are Int_t but can sometimes
       // be 'large' (i.e. 30Mb * 300 intervals) and can overflow the numerical limit of Int_t (i.e. become
       // artificially negative).   To avoid this issue we promote fNtotCurrentBuf to a long long (64 bits rather than 32 bits)
-      if (!((fBufferSizeMin > ((Long64_t)fNtotCurrentBuf*(clusterIterations+1))/clusterIterations) && (prevNtot < fNtotCurrentBuf) && (minEntry < fEntryMax)))
+      // In prefetching mode we also continue until at least minClusters have been registered.
+      if (!((clusterIterations < minClusters || fBufferSizeMin > ((Long64_t)fNtotCurrentBuf*(clusterIterations+1))/clusterIterations) && (prevNtot < fNtotCurrentBuf) && (minEntry < fEntryMax)))
          break;
 
       //for the reverse reading case
@@ -1193,6 +1214,24 @@ TTreeCache::EPrefillType TTreeCache::GetConfiguredPrefillType() const
    return static_cast<TTreeCache::EPrefillType>(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the desired prefetch depth from the environment or resource variable,
+/// i.e. the minimum number of clusters read ahead by each asynchronous prefetch.
+
+Int_t TTreeCache::GetConfiguredPrefetchDepth() const
+{
+   const char *stcp;
+   Int_t s = 0;
+
+   if (!(stcp = gSystem->Getenv("ROOT_TTREECACHE_PREFETCHDEPTH")) || !*stcp) {
+      s = gEnv->GetValue("TTreeCache.PrefetchDepth", 1);
+   } else {
+      s = TString(stcp).Atoi();
+   }
+
+   return s < 1 ? 1 : s;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Give the total efficiency of the primary cache... defined as the ratio
 /// of blocks found in the cache vs. the number of blocks prefetched
@@ -1501,6 +1540,21 @@ void TTreeCache::SetLearnPrefill(TTreeCache::EPrefillType type /* = kNoPrefill *
    fPrefillType = type;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the minimum number of clusters read ahead by each asynchronous prefetch
+/// when prefetching is enabled (see TFileCacheRead::SetEnablePrefetching).
+/// While the entries of the current block of clusters are processed, the next
+/// block of at least `nclusters` clusters is read in the background, even if
+/// this exceeds the cache size. A depth of 1 (the default) lets the cache size
+/// alone decide how many clusters are read ahead.
+/// The default can be controlled by setting TTreeCache.PrefetchDepth or the
+/// environment variable ROOT_TTREECACHE_PREFETCHDEPTH.
+
+void TTreeCache::SetPrefetchDepth(Int_t nclusters /* = 1 */)
+{
+   fPrefetchDepth = nclusters < 1 ? 1 : nclusters;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The name should be enough to explain the method.
 /// The only additional comments is that the cache is cleaned before
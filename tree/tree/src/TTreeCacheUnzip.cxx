@@ -52,6 +52,8 @@ where bufferSize must be passed in bytes.
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <thread>
+
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #endif
@@ -333,6 +335,8 @@ Bool_t TTreeCacheUnzip::FillBuffer()
       TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
       if (b->GetDirectory() == 0) continue;
       if (b->GetDirectory()->GetFile() != fFile) continue;
+      // Uncompressed baskets are read directly from the memory mapped file.
+      if (fFile->IsMemoryMapped() && b->GetCompressionLevel() == 0) continue;
       Int_t nb = b->GetMaxBaskets();
       Int_t *lbaskets   = b->GetBasketBytes();
       Long64_t *entries = b->GetBasketEntry();
@@ -627,6 +631,8 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 /// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
 /// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping 
 /// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// When the prefetched cluster is small compared to the size of the IMT pool, the
+/// groups are shrunk so that each thread of the pool gets at least a few tasks.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
@@ -646,21 +652,28 @@ Int_t TTreeCacheUnzip::CreateTasks()
          return nullptr;
       };
 
-      Int_t accusz = 0;
+      // Split the baskets of the cluster into groups of at least fUnzipGroupSize bytes.
+      // If the cluster is too small to give every thread of the pool a few groups,
+      // the group size is lowered so that decompression still scales with the
+      // number of cores (e.g. for CPU bound algorithms like LZMA).
+      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
+      Long64_t totalsz = 0;
+      for (Int_t i = 0; i < fNseek; i++) totalsz += fSeekLen[i];
+      Long64_t groupsz = fUnzipGroupSize;
+      const Long64_t ntasks = 4 * (Long64_t)ROOT::GetImplicitMTPoolSize();
+      if (ntasks > 0 && totalsz / ntasks < groupsz) groupsz = totalsz / ntasks;
+
+      Long64_t accusz = 0;
       std::vector<std::vector<Int_t>> basketIndices;
       std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
       for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
+         accusz += fSeekLen[i];
+         indices.push_back(i);
+         if (accusz >= groupsz || i == fNseek - 1) {
+            basketIndices.push_back(indices);
+            indices.clear();
+            accusz = 0;
          }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
       }
       ROOT::TThreadExecutor pool;
       pool.Foreach(unzipFunction, basketIndices);
@@ -755,6 +768,9 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                   } else {
                      UnzipCache(reqi);
                   }
+               } else {
+                  // Nothing left to steal, let the task unzipping our basket run.
+                  std::this_thread::yield();
                }
  
                if ( myCycle != fCycle ) {
@@ -822,7 +838,9 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 	 res = fFile->ReadBuffer(fCompBuffer, len);
       } // end of lock scope
 #ifdef R__USE_IMT
-      CreateTasks();
+      if(ROOT::IsImplicitMTEnabled()) {
+         CreateTasks();
+      }
 #endif
    }
 
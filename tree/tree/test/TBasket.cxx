@@ -4,7 +4,9 @@
 #include "TBranch.h"
 #include "TEnum.h"
 #include "TEnumConstant.h"
+#include "TFile.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
@@ -403,3 +405,79 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+#ifndef _WIN32
+// Read the branches of the tree, one row of values per entry, starting from
+// the first or from the last entry.
+static std::vector<std::vector<Double_t>> ReadMappedTestTree(TTree *tree, bool backwards)
+{
+   Int_t idx, n;
+   Double_t arr[10];
+   tree->SetBranchAddress("idx", &idx);
+   tree->SetBranchAddress("n", &n);
+   tree->SetBranchAddress("arr", arr);
+   const Long64_t nEntries = tree->GetEntries();
+   std::vector<std::vector<Double_t>> rows(nEntries);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      const Long64_t entry = backwards ? nEntries - 1 - i : i;
+      tree->GetEntry(entry);
+      rows[entry].push_back(idx);
+      rows[entry].insert(rows[entry].end(), arr, arr + n);
+   }
+   tree->ResetBranchAddresses();
+   return rows;
+}
+
+// The uncompressed baskets of a memory mapped file are read in place: check
+// that they give the same content as a normal read, also once the file has
+// been unmapped while some of them are still loaded.
+TEST(TBasket, MemoryMapped)
+{
+   const char *fname = "tbasket_mmap_test.root";
+   {
+      TFile f(fname, "RECREATE", "", 0);
+      TTree t("t", "Uncompressed tree for testing.");
+      Int_t idx, n;
+      Double_t arr[10];
+      t.Branch("idx", &idx, "idx/I", 1000);
+      t.Branch("n", &n, "n/I", 1000);
+      t.Branch("arr", arr, "arr[n]/D", 1000);
+      for (idx = 0; idx < 10 * gSampleEvents; idx++) {
+         n = idx % 10;
+         for (Int_t i = 0; i < n; ++i)
+            arr[i] = idx + 0.1 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   std::vector<std::vector<Double_t>> expected;
+   {
+      TFile f(fname);
+      TTree *tree = nullptr;
+      f.GetObject("t", tree);
+      ASSERT_NE(tree, nullptr);
+      EXPECT_EQ(tree->GetBranch("arr")->GetCompressionLevel(), 0);
+      expected = ReadMappedTestTree(tree, false);
+   }
+   ASSERT_EQ(expected.size(), 10u * gSampleEvents);
+
+   {
+      TFile f(fname);
+      ASSERT_TRUE(f.SetMemoryMapped(kTRUE));
+      EXPECT_TRUE(f.IsMemoryMapped());
+      TTree *tree = nullptr;
+      f.GetObject("t", tree);
+      ASSERT_NE(tree, nullptr);
+      EXPECT_EQ(ReadMappedTestTree(tree, false), expected);
+
+      // The baskets of the last entries are still loaded and wrap the mapped
+      // pages: they must stay readable after unmapping.
+      ASSERT_TRUE(f.SetMemoryMapped(kFALSE));
+      EXPECT_FALSE(f.IsMemoryMapped());
+      EXPECT_EQ(ReadMappedTestTree(tree, true), expected);
+   }
+
+   gSystem->Unlink(fname);
+}
+#endif
@@ -1,3 +1,5 @@
+#include "Bytes.h"
+#include "TBufferFile.h"
 #include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
@@ -5,6 +7,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 class TBranchTest : public ::testing::Test {
 protected:
    virtual void SetUp()
@@ -153,3 +157,39 @@ TEST_F(TBranchTest, twoPreviousTest)
    ASSERT_TRUE(branch->GetListOfBaskets()->At(7));
    delete file;
 }
+
+TEST_F(TBranchTest, bulkEntriesTest)
+{
+   TFile *file = new TFile("TBranchTestTree.root");
+   TTree *tree = (TTree *)file->Get("tree");
+   TBranch *branch = tree->GetBranch("branch");
+
+   std::vector<Float_t> expected;
+   Float_t data = 0;
+   branch->SetAddress(&data);
+   for (Long64_t ev = 0; ev < tree->GetEntries(); ev++) {
+      branch->GetEntry(ev);
+      expected.push_back(data);
+   }
+
+   // Start in the middle of the first basket, then go basket by basket.
+   TBufferFile buf(TBuffer::kWrite, 1);
+   Long64_t ev = 5;
+   while (Int_t n = branch->GetBulkEntries(ev, buf)) {
+      ASSERT_GT(n, 0);
+      const Float_t *values = reinterpret_cast<Float_t *>(buf.Buffer());
+      for (Int_t i = 0; i < n; i++) {
+         EXPECT_EQ(expected[ev + i], values[i]);
+      }
+      ev += n;
+   }
+   EXPECT_EQ(ev, tree->GetEntries());
+
+   // The serialized values are big-endian.
+   ASSERT_GT(branch->GetEntriesSerialized(0, buf), 0);
+   Float_t first;
+   char *ptr = buf.Buffer();
+   frombuf(ptr, &first);
+   EXPECT_EQ(expected[0], first);
+   delete file;
+}
@@ -0,0 +1,83 @@
+
+#include "Compression.h"
+#include "ROOT/TCompressionPolicy.hxx"
+#include "TBranch.h"
+#include "TMemFile.h"
+#include "TRandom3.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+TEST(TCompressionPolicy, Rules)
+{
+   ROOT::Experimental::TCompressionPolicy policy;
+   policy.AddRule("jet_*", ROOT::CompressionSettings(ROOT::kLZ4, 4));
+   policy.AddRule("*", ROOT::CompressionSettings(ROOT::kLZMA, 8));
+
+   EXPECT_EQ(policy.FindRule("jet_pt"), ROOT::CompressionSettings(ROOT::kLZ4, 4));
+   EXPECT_EQ(policy.FindRule("provenance"), ROOT::CompressionSettings(ROOT::kLZMA, 8));
+
+   ROOT::Experimental::TCompressionPolicy empty;
+   EXPECT_EQ(empty.FindRule("jet_pt"), -1);
+}
+
+TEST(TCompressionPolicy, Evaluate)
+{
+   ROOT::Experimental::TCompressionPolicy policy;
+   policy.AddCandidate(0);
+   policy.AddCandidate(ROOT::CompressionSettings(ROOT::kZLIB, 1));
+
+   // Highly redundant data: compressing must win when only the size matters.
+   std::vector<char> zeros(32000, 0);
+   std::vector<Double_t> costs;
+   policy.SetCalibration(1, 0.);
+   policy.Evaluate(zeros.data(), zeros.size(), costs);
+   ASSERT_EQ(costs.size(), 2u);
+   EXPECT_DOUBLE_EQ(costs[0], 1.);
+   EXPECT_LT(costs[1], costs[0]);
+   EXPECT_EQ(policy.GetBestCandidate(costs), ROOT::CompressionSettings(ROOT::kZLIB, 1));
+
+   // The decompression time is normalized to the slowest candidate: here the
+   // only compressing one, which thus gets exactly timeWeight added.
+   std::vector<Double_t> timedCosts;
+   policy.SetCalibration(1, 1.);
+   policy.Evaluate(zeros.data(), zeros.size(), timedCosts);
+   ASSERT_EQ(timedCosts.size(), 2u);
+   EXPECT_DOUBLE_EQ(timedCosts[0], 1.);
+   EXPECT_DOUBLE_EQ(timedCosts[1], costs[1] + 1.);
+}
+
+TEST(TCompressionPolicy, Tree)
+{
+   TMemFile f("tcompressionpolicy_test.root", "CREATE");
+   ASSERT_FALSE(f.IsZombie());
+
+   TTree t("t", "Tree with a compression policy");
+   Int_t zero = 0;
+   UInt_t noise = 0;
+   Int_t fixed = 0;
+   t.Branch("zero", &zero, "zero/I", 4000);
+   t.Branch("noise", &noise, "noise/i", 4000);
+   t.Branch("fixed", &fixed, "fixed/I", 4000);
+
+   ROOT::Experimental::TCompressionPolicy policy;
+   policy.AddRule("fix*", ROOT::CompressionSettings(ROOT::kLZMA, 3));
+   policy.AddCandidate(0);
+   policy.AddCandidate(ROOT::CompressionSettings(ROOT::kZLIB, 1));
+   policy.SetCalibration(2);
+   t.SetCompressionPolicy(policy);
+
+   TRandom3 rnd(1);
+   for (Int_t i = 0; i < 10000; ++i) {
+      noise = rnd.Integer(kMaxUInt);
+      fixed = i;
+      t.Fill();
+   }
+
+   EXPECT_EQ(t.GetBranch("fixed")->GetCompressionSettings(), ROOT::CompressionSettings(ROOT::kLZMA, 3));
+   EXPECT_EQ(t.GetBranch("zero")->GetCompressionSettings(), ROOT::CompressionSettings(ROOT::kZLIB, 1));
+   // Random bits do not compress
+   EXPECT_EQ(t.GetBranch("noise")->GetCompressionSettings(), 0);
+}
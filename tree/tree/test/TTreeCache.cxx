@@ -0,0 +1,119 @@
+#include "TError.h"
+#include "TFile.h"
+#include "TRandom3.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+
+static const char *kPrefetchFile = "ttreecache_prefetch.root";
+static const Long64_t kClusterEntries = 2000;
+static const Long64_t kEntries = 25 * kClusterEntries;
+
+// Access to the range of entries of the block of clusters in the cache
+struct TTreeCacheRange : public TTreeCache {
+   static Long64_t Size(const TTreeCache &cache)
+   {
+      return cache.*(&TTreeCacheRange::fEntryNext) - cache.*(&TTreeCacheRange::fEntryCurrent);
+   }
+};
+
+class TTreeCachePrefetch : public ::testing::Test {
+protected:
+   // Clusters of about 64 kB of incompressible data each
+   static void SetUpTestCase()
+   {
+      TFile f(kPrefetchFile, "RECREATE");
+      TTree t("t", "t");
+      Long64_t i = 0;
+      Double_t x[4];
+      t.Branch("i", &i);
+      for (Int_t b = 0; b < 4; ++b)
+         t.Branch(TString::Format("x%d", b), &x[b]);
+      t.SetAutoFlush(kClusterEntries);
+      TRandom3 rnd(1);
+      for (i = 0; i < kEntries; ++i) {
+         for (auto &v : x)
+            v = rnd.Rndm();
+         t.Fill();
+      }
+      t.Write();
+   }
+   static void TearDownTestCase() { gSystem->Unlink(kPrefetchFile); }
+};
+
+// Read all the entries with asynchronous prefetching and the given prefetch
+// depth, check them and return the largest number of entries read in a block
+static Long64_t ReadEntries(Int_t depth)
+{
+   TFile f(kPrefetchFile);
+   TTree *t = nullptr;
+   f.GetObject("t", t);
+   EXPECT_NE(t, nullptr);
+   if (!t)
+      return 0;
+
+   // Room for one cluster only
+   t->SetCacheSize(100000);
+   auto cache = dynamic_cast<TTreeCache *>(f.GetCacheRead(t));
+   EXPECT_NE(cache, nullptr);
+   if (!cache)
+      return 0;
+   cache->SetEnablePrefetching(kTRUE);
+   cache->SetPrefetchDepth(depth);
+   t->AddBranchToCache("*", kTRUE);
+
+   Long64_t i = -1;
+   t->SetBranchAddress("i", &i);
+   Long64_t maxBlock = 0;
+   for (Long64_t entry = 0; entry < kEntries; ++entry) {
+      t->GetEntry(entry);
+      EXPECT_EQ(i, entry);
+      maxBlock = std::max(maxBlock, TTreeCacheRange::Size(*cache));
+   }
+   t->ResetBranchAddresses();
+   return maxBlock;
+}
+
+// The prefetching thread can issue warnings as well
+static std::atomic<Int_t> gNWarnings(0);
+
+static void CountWarnings(Int_t level, Bool_t abort, const char *location, const char *msg)
+{
+   if (level >= kWarning && level < kError)
+      ++gNWarnings;
+   DefaultErrorHandler(level, abort, location, msg);
+}
+
+// As ReadEntries, checking that no warning is issued: the blocks are expected
+// to exceed the cache size
+static Long64_t ReadWithPrefetchDepth(Int_t depth)
+{
+   gNWarnings = 0;
+   ErrorHandlerFunc_t oldHandler = SetErrorHandler(CountWarnings);
+   Long64_t maxBlock = ReadEntries(depth);
+   SetErrorHandler(oldHandler);
+   EXPECT_EQ(gNWarnings.load(), 0) << "prefetch depth " << depth;
+   return maxBlock;
+}
+
+TEST_F(TTreeCachePrefetch, Depth)
+{
+   // The default reads as many clusters as fit in the cache
+   const Long64_t defaultBlock = ReadWithPrefetchDepth(1);
+   EXPECT_EQ(defaultBlock, kClusterEntries);
+
+   // A depth of 0 keeps the default
+   TTreeCache cache;
+   cache.SetPrefetchDepth(0);
+   EXPECT_EQ(cache.GetPrefetchDepth(), 1);
+   EXPECT_EQ(ReadWithPrefetchDepth(0), defaultBlock);
+
+   // At least 4 or 8 clusters are read ahead, beyond the cache size
+   EXPECT_GE(ReadWithPrefetchDepth(4), 4 * kClusterEntries);
+   EXPECT_GE(ReadWithPrefetchDepth(8), 8 * kClusterEntries);
+}
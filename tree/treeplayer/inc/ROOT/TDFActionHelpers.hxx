@@ -22,6 +22,7 @@
 #include "Compression.h"
 #include "ROOT/TVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
+#include "ROOT/TConcurrentFillHist.hxx"
 #include "ROOT/TDFUtils.hxx"
 #include "ROOT/TSnapshotOptions.hxx"
 #include "ROOT/TThreadedObject.hxx"
@@ -262,6 +263,62 @@ public:
    HIST &PartialUpdate(unsigned int slot) { return *fTo->GetAtSlotRaw(slot); }
 };
 
+/// Fills a histogram shared by all slots through a TConcurrentFillHist, instead of one clone per slot
+template <typename HIST = Hist_t>
+class FillConcurrentHelper {
+   std::unique_ptr<TConcurrentFillHist<HIST>> fHist;
+   /// Histograms containing "snapshots" of partial results. Non-null only if a registered callback requires it.
+   std::vector<std::unique_ptr<HIST>> fPartialHists;
+
+   /// Fill with the values of containers of the same size, which need not provide random access (e.g. std::list)
+   template <typename It0, typename... Its>
+   void FillFromIterators(unsigned int slot, It0 x0sIt, const It0 x0sEnd, Its... xsIts)
+   {
+      for (; x0sIt != x0sEnd; ++x0sIt) {
+         fHist->FillAtSlot(slot, *x0sIt, *xsIts...);
+         std::initializer_list<int> expander{(++xsIts, 0)...};
+         (void)expander; // avoid "unused variable" warnings
+      }
+   }
+
+public:
+   FillConcurrentHelper(FillConcurrentHelper &&) = default;
+   FillConcurrentHelper(const FillConcurrentHelper &) = delete;
+
+   FillConcurrentHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fHist(new TConcurrentFillHist<HIST>(h, nSlots)), fPartialHists(nSlots)
+   {
+   }
+
+   void InitSlot(TTreeReader *, unsigned int) {}
+
+   template <typename... Xs, typename std::enable_if<!IsContainer<TakeFirstType_t<Xs...>>::value, int>::type = 0>
+   void Exec(unsigned int slot, Xs... xs) // 1D, 2D and 3D histos, with and without weights
+   {
+      fHist->FillAtSlot(slot, xs...);
+   }
+
+   template <typename X0, typename... Xs, typename std::enable_if<IsContainer<X0>::value, int>::type = 0>
+   void Exec(unsigned int slot, const X0 &x0s, const Xs &... xs)
+   {
+      const auto size = x0s.size();
+      for (auto xsize : std::initializer_list<std::size_t>{xs.size()...}) {
+         if (xsize != size) {
+            throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+         }
+      }
+      FillFromIterators(slot, std::begin(x0s), std::end(x0s), std::begin(xs)...);
+   }
+
+   void Finalize() { fHist->Flush(); }
+
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      fPartialHists[slot] = fHist->Snapshot(slot);
+      return *fPartialHists[slot];
+   }
+};
+
 // In case of the take helper we have 4 cases:
 // 1. The column is not an TVec, the collection is not a vector
 // 2. The column is not an TVec, the collection is a vector
@@ -121,10 +121,14 @@ struct HistoUtils<T, true> {
    static bool HasAxisLimits(T &) { return true; }
 };
 
-// Generic filling (covers Histo2D, Histo3D, Profile1D and Profile2D actions, with and without weights)
-template <typename... BranchTypes, typename ActionType, typename ActionResultType, typename PrevNodeType>
-TActionBase *BuildAndBook(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h,
-                          const unsigned int nSlots, TLoopManager &loopManager, PrevNodeType &prevNode, ActionType *)
+/// Minimum number of cells of the per-slot clones of a histogram, all slots together, above which the slots
+/// rather share the histogram, filled through a ROOT::TConcurrentFillHist
+constexpr Long64_t kMinConcurrentFillCells = 1 << 23;
+
+// Filling of objects that are not histograms, through one clone per slot
+template <typename... BranchTypes, typename ActionResultType, typename PrevNodeType>
+TActionBase *BookFill(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
+                      TLoopManager &loopManager, PrevNodeType &prevNode, std::false_type /*isTH1*/)
 {
    using Helper_t = FillTOHelper<ActionResultType>;
    using Action_t = TAction<Helper_t, PrevNodeType, TTraits::TypeList<BranchTypes...>>;
@@ -133,6 +137,29 @@ TActionBase *BuildAndBook(const ColumnNames_t &bl, const std::shared_ptr<ActionR
    return action.get();
 }
 
+// Filling of histograms, through one clone per slot or, for large histograms, concurrently
+template <typename... BranchTypes, typename ActionResultType, typename PrevNodeType>
+TActionBase *BookFill(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
+                      TLoopManager &loopManager, PrevNodeType &prevNode, std::true_type /*isTH1*/)
+{
+   if (nSlots > 1 && h->GetNcells() * Long64_t(nSlots) > kMinConcurrentFillCells) {
+      using Helper_t = FillConcurrentHelper<ActionResultType>;
+      using Action_t = TAction<Helper_t, PrevNodeType, TTraits::TypeList<BranchTypes...>>;
+      auto action = std::make_shared<Action_t>(Helper_t(h, nSlots), bl, prevNode);
+      loopManager.Book(action);
+      return action.get();
+   }
+   return BookFill<BranchTypes...>(bl, h, nSlots, loopManager, prevNode, std::false_type());
+}
+
+// Generic filling (covers Histo2D, Histo3D, Profile1D and Profile2D actions, with and without weights)
+template <typename... BranchTypes, typename ActionType, typename ActionResultType, typename PrevNodeType>
+TActionBase *BuildAndBook(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h,
+                          const unsigned int nSlots, TLoopManager &loopManager, PrevNodeType &prevNode, ActionType *)
+{
+   return BookFill<BranchTypes...>(bl, h, nSlots, loopManager, prevNode, std::is_base_of<::TH1, ActionResultType>());
+}
+
 // Histo1D filling (must handle the special case of distinguishing FillTOHelper and FillHelper
 template <typename... BranchTypes, typename PrevNodeType>
 TActionBase *BuildAndBook(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const unsigned int nSlots,
@@ -140,22 +167,15 @@ TActionBase *BuildAndBook(const ColumnNames_t &bl, const std::shared_ptr<::TH1D>
 {
    auto hasAxisLimits = HistoUtils<::TH1D>::HasAxisLimits(*h);
 
-   TActionBase *actionBase;
    if (hasAxisLimits) {
-      using Helper_t = FillTOHelper<::TH1D>;
-      using Action_t = TAction<Helper_t, PrevNodeType, TTraits::TypeList<BranchTypes...>>;
-      auto action = std::make_shared<Action_t>(Helper_t(h, nSlots), bl, prevNode);
-      loopManager.Book(action);
-      actionBase = action.get();
-   } else {
-      using Helper_t = FillHelper;
-      using Action_t = TAction<Helper_t, PrevNodeType, TTraits::TypeList<BranchTypes...>>;
-      auto action = std::make_shared<Action_t>(Helper_t(h, nSlots), bl, prevNode);
-      loopManager.Book(action);
-      actionBase = action.get();
+      return BookFill<BranchTypes...>(bl, h, nSlots, loopManager, prevNode, std::true_type());
    }
 
-   return actionBase;
+   using Helper_t = FillHelper;
+   using Action_t = TAction<Helper_t, PrevNodeType, TTraits::TypeList<BranchTypes...>>;
+   auto action = std::make_shared<Action_t>(Helper_t(h, nSlots), bl, prevNode);
+   loopManager.Book(action);
+   return action.get();
 }
 
 // Min action
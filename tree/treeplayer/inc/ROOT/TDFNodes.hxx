@@ -62,6 +62,45 @@ public:
    void ReturnSlot(unsigned int slotNumber);
    unsigned int GetSlot();
 };
+
+/// The TTreeReaderValues or TTreeReaderArrays of one column and one slot, kept between the tasks that use them.
+/// A value reader released by a task is detached from its TTreeReader, so that it is not notified when that
+/// TTreeReader, used by a task of another slot, changes tree. A later task of the slot that runs on the same
+/// TTreeReader attaches it again instead of constructing a new one: its branch proxy is kept.
+/// The TTreeReaders must not be destroyed before Clear() is called, except those reading a TEntryList: the value
+/// readers of these are destroyed when they are released. Not thread-safe: only the task that holds the slot uses it.
+template <typename TreeReader_t>
+class TValueReaderCache {
+   std::vector<std::pair<TTreeReader *, std::unique_ptr<TreeReader_t>>> fReaders;
+
+public:
+   /// Return the value reader released by a previous task running on `r`, or a new one
+   std::unique_ptr<TreeReader_t> Get(TTreeReader &r, const std::string &bn)
+   {
+      for (auto it = fReaders.begin(); it != fReaders.end(); ++it) {
+         if (it->first == &r) {
+            std::unique_ptr<TreeReader_t> reader(std::move(it->second));
+            fReaders.erase(it);
+            reader->AttachToTreeReader(&r);
+            return reader;
+         }
+      }
+      return std::unique_ptr<TreeReader_t>(new TreeReader_t(r, bn.c_str()));
+   }
+
+   /// Keep the value reader of a completed task, detached from its TTreeReader
+   void Release(std::unique_ptr<TreeReader_t> &&reader)
+   {
+      auto r = reader->GetTreeReader();
+      if (!r || r->GetEntryList())
+         return;
+      reader->DetachFromTreeReader();
+      fReaders.emplace_back(r, std::move(reader));
+   }
+
+   std::size_t GetSize() const { return fReaders.size(); }
+   void Clear() { fReaders.clear(); }
+};
 }
 }
 
@@ -161,6 +200,7 @@ class TLoopManager : public std::enable_shared_from_this<TLoopManager> {
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(unsigned int slot);
+   void CleanUpValueReaderCaches();
    void JitActions();
    void EvalChildrenCounts();
 
@@ -252,6 +292,9 @@ class TColumnValue {
 
    /// Owning ptrs to a TTreeReaderValue or TTreeReaderArray. Only used for Tree columns.
    std::vector<std::unique_ptr<TreeReader_t>> fTreeReaders;
+   /// TTreeReaderValues or TTreeReaderArrays released by completed tasks, reused by later ones. Only used for Tree
+   /// columns.
+   TDFInternal::TValueReaderCache<TreeReader_t> fTreeReaderCache;
    /// Non-owning ptrs to the value of a custom column.
    std::vector<T *> fCustomValuePtrs;
    /// Non-owning ptrs to the value of a data-source column.
@@ -274,7 +317,7 @@ public:
    void MakeProxy(TTreeReader *r, const std::string &bn)
    {
       fColumnKind = EColumnKind::kTree;
-      fTreeReaders.emplace_back(new TreeReader_t(*r, bn.c_str()));
+      fTreeReaders.emplace_back(fTreeReaderCache.Get(*r, bn));
    }
 
    /// This overload is used to return scalar quantities (i.e. types that are not read into a TVec)
@@ -289,7 +332,10 @@ public:
    void Reset()
    {
       switch (fColumnKind) {
-      case EColumnKind::kTree: fTreeReaders.pop_back(); break;
+      case EColumnKind::kTree:
+         fTreeReaderCache.Release(std::move(fTreeReaders.back()));
+         fTreeReaders.pop_back();
+         break;
       case EColumnKind::kCustomColumn:
          fCustomColumns.pop_back();
          fCustomValuePtrs.pop_back();
@@ -301,6 +347,9 @@ public:
       case EColumnKind::kInvalid: throw std::runtime_error("ColumnKind not set for this TColumnValue");
       }
    }
+
+   /// Destroy the readers kept for later tasks, before their TTreeReaders are destroyed
+   void ClearCache() { fTreeReaderCache.Clear(); }
 };
 
 template <typename T>
@@ -324,6 +373,14 @@ void ResetTDFValueTuple(ValueTuple &values, StaticSeq<S...>)
    (void)expander; // avoid "unused variable" warnings
 }
 
+/// Destroy the readers that a tuple of TColumnValues keeps for later tasks
+template <typename ValueTuple, int... S>
+void ClearTDFValueTupleCaches(ValueTuple &values, StaticSeq<S...>)
+{
+   std::initializer_list<int> expander{(std::get<S>(values).ClearCache(), 0)...};
+   (void)expander; // avoid "unused variable" warnings
+}
+
 class TActionBase {
 protected:
    TLoopManager *fImplPtr;     ///< A raw pointer to the TLoopManager at the root of this functional
@@ -341,6 +398,7 @@ public:
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
    virtual void ClearValueReaders(unsigned int slot) = 0;
+   virtual void ClearValueReaderCaches(unsigned int slot) = 0;
    unsigned int GetNSlots() const { return fNSlots; }
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via TResultProxy::RegisterCallback
@@ -391,6 +449,10 @@ public:
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
 
    virtual void ClearValueReaders(unsigned int slot) final { ResetTDFValueTuple(fValues[slot], TypeInd_t()); }
+   virtual void ClearValueReaderCaches(unsigned int slot) final
+   {
+      ClearTDFValueTupleCaches(fValues[slot], TypeInd_t());
+   }
 
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via TResultProxy::RegisterCallback
@@ -438,6 +500,7 @@ public:
    std::string GetName() const;
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    virtual void ClearValueReaders(unsigned int slot) = 0;
+   virtual void ClearValueReaderCaches(unsigned int slot) = 0;
    unsigned int GetNSlots() const { return fNSlots; }
    bool IsDataSourceColumn() const { return fIsDataSourceColumn; }
    void InitNode();
@@ -540,6 +603,7 @@ public:
    }
 
    void ClearValueReaders(unsigned int slot) final { ResetTDFValueTuple(fValues[slot], TypeInd_t()); }
+   void ClearValueReaderCaches(unsigned int slot) final { ClearTDFValueTupleCaches(fValues[slot], TypeInd_t()); }
 };
 
 class TFilterBase {
@@ -584,6 +648,7 @@ public:
       std::fill(fRejected.begin(), fRejected.end(), 0);
    }
    virtual void ClearValueReaders(unsigned int slot) = 0;
+   virtual void ClearValueReaderCaches(unsigned int slot) = 0;
    void InitNode();
 };
 
@@ -670,6 +735,10 @@ public:
    }
 
    virtual void ClearValueReaders(unsigned int slot) final { ResetTDFValueTuple(fValues[slot], TypeInd_t()); }
+   virtual void ClearValueReaderCaches(unsigned int slot) final
+   {
+      ClearTDFValueTupleCaches(fValues[slot], TypeInd_t());
+   }
 };
 
 class TRangeBase {
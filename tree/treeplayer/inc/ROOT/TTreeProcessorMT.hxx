@@ -23,6 +23,7 @@
 #include "ROOT/TThreadedObject.hxx"
 
 #include <string.h>
+#include <atomic>
 #include <functional>
 #include <vector>
 
@@ -64,6 +65,7 @@ namespace ROOT {
          std::string fTreeName;                         ///< Name of the tree
          TEntryList fEntryList;                         ///< Entry numbers to be processed
          std::vector<Long64_t> fLoadedEntries;          ///<! Per-task loaded entries (for task interleaving)
+         std::vector<std::unique_ptr<TTreeReader>> fFreeReaders; ///<! Readers of completed tasks, reused by later tasks
          std::vector<NameAlias> fFriendNames;           ///< <name,alias> pairs of the friends of the tree/chain
          std::vector<std::vector<std::string>> fFriendFileNames; ///< Names of the files where friends are stored
 
@@ -268,8 +270,16 @@ namespace ROOT {
 
                reader.reset(new TTreeReader(fChain.get(), elist.get()));
             } else {
-               // If no TEntryList is involved we can safely set the range in the reader
-               reader.reset(new TTreeReader(fChain.get()));
+               // If no TEntryList is involved we can safely set the range in the reader.
+               // A reader left by a previous task keeps its branch proxies, which the value readers of this
+               // task pick up again. It is always rewound, so that these value readers can be registered.
+               if (fFreeReaders.empty()) {
+                  reader.reset(new TTreeReader(fChain.get()));
+               } else {
+                  reader = std::move(fFreeReaders.back());
+                  fFreeReaders.pop_back();
+                  reader->Restart();
+               }
                fChain->LoadTree(start - 1);
                reader->SetEntriesRange(start, end);
             }
@@ -277,6 +287,18 @@ namespace ROOT {
             return std::make_pair(std::move(reader), std::move(elist));
          }
 
+         //////////////////////////////////////////////////////////////////////////
+         /// Give back the reader of a completed task, to be reused by the next task
+         /// of this thread. Readers that work on a TEntryList are discarded.
+         /// The value readers of the task must have been destroyed or detached (see
+         /// TTreeReaderValueBase::DetachFromTreeReader()) at this point, so that they
+         /// are deregistered from the reader.
+         void ReturnTreeReader(TreeReaderEntryListPair &&readerAndEntryList)
+         {
+            if (!readerAndEntryList.second)
+               fFreeReaders.emplace_back(std::move(readerAndEntryList.first));
+         }
+
          //////////////////////////////////////////////////////////////////////////
          /// Get the filenames for this view.
          const std::vector<std::string> &GetFileNames() const
@@ -311,6 +333,7 @@ namespace ROOT {
    class TTreeProcessorMT {
    private:
       ROOT::TThreadedObject<ROOT::Internal::TTreeView> treeView; ///<! Thread-local TreeViews
+      static std::atomic<unsigned int> fgTasksPerWorkerHint; ///< Number of tasks per worker that clusters are split into
 
       std::vector<ROOT::Internal::TreeViewCluster> MakeClusters();
    public:
@@ -321,6 +344,9 @@ namespace ROOT {
  
       void Process(std::function<void(TTreeReader&)> func);
 
+      static void SetTasksPerWorkerHint(unsigned int nTasks);
+      static unsigned int GetTasksPerWorkerHint();
+
    };
 
 } // End of namespace ROOT
@@ -192,6 +192,7 @@ public:
    virtual TLeaf      *GetLeaf(Int_t n) const;
    virtual Int_t       GetNcodes() const {return fNcodes;}
    virtual Int_t       GetNdata();
+           Bool_t      HasMethodCalls() const;
    //GetNdata should probably be const.  However it need to cache some information about the actual dimension
    //of arrays, so if GetNdata is const, the variables fUsedSizes and fCumulUsedSizes need to be declared
    //mutable.  We will be able to do that only when all the compilers supported for ROOT actually implemented
@@ -40,6 +40,9 @@ namespace Internal {
 
       virtual EReadStatus GetReadStatus() const { return fImpl ? fImpl->fReadStatus : kReadError; }
 
+      virtual void DetachFromTreeReader();
+      virtual void AttachToTreeReader(TTreeReader* reader);
+
    protected:
       void *UntypedAt(std::size_t idx) const { return fImpl->At(GetProxy(), idx); }
       virtual void CreateProxy();
@@ -69,6 +69,9 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Detach or attach again the value readers used internally, see TTreeReaderValueBase::DetachFromTreeReader()
+      virtual void DetachFromTreeReader() {}
+      virtual void AttachToTreeReader(TTreeReader* /*reader*/) {}
    };
 
 }
@@ -78,6 +78,12 @@ namespace Internal {
 
       const char* GetBranchName() const { return fBranchName; }
 
+      /// The TTreeReader this value reader is registered with, or nullptr if it has been destructed or detached.
+      TTreeReader* GetTreeReader() const { return fTreeReader; }
+
+      virtual void DetachFromTreeReader();
+      virtual void AttachToTreeReader(TTreeReader* reader);
+
       virtual ~TTreeReaderValueBase();
 
    protected:
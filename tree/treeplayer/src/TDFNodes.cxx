@@ -225,6 +225,8 @@ void TLoopManager::RunTreeProcessorMT()
       CleanUpTask(slot);
       slotStack.ReturnSlot(slot);
    });
+   // the value readers kept by the nodes refer to the TTreeReaders of tp
+   CleanUpValueReaderCaches();
 #endif // no-op otherwise (will not be called)
 }
 
@@ -381,6 +383,20 @@ void TLoopManager::CleanUpTask(unsigned int slot)
       pair.second->ClearValueReaders(slot);
 }
 
+/// Destroy the value readers that the nodes keep between the tasks of an event loop.
+/// To be called at the end of a multi-thread event loop over ROOT files, before the TTreeReaders are destroyed.
+void TLoopManager::CleanUpValueReaderCaches()
+{
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      for (auto &ptr : fBookedActions)
+         ptr->ClearValueReaderCaches(slot);
+      for (auto &ptr : fBookedFilters)
+         ptr->ClearValueReaderCaches(slot);
+      for (auto &pair : fBookedCustomColumns)
+         pair.second->ClearValueReaderCaches(slot);
+   }
+}
+
 /// Jit all actions that required runtime column type inference, and clean the `fToJit` member variable.
 void TLoopManager::JitActions()
 {
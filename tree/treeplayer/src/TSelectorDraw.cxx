@@ -14,6 +14,7 @@ A specialized TSelector for TTree::Draw.
 */
 
 #include "TSelectorDraw.h"
+#include "RConfigure.h" // R__USE_IMT
 #include "TROOT.h"
 #include "TH2.h"
 #include "TH3.h"
@@ -35,6 +36,17 @@ A specialized TSelector for TTree::Draw.
 #include "TStyle.h"
 #include "TClass.h"
 #include "TColor.h"
+#include "TChain.h"
+#include "TFile.h"
+#include "TFriendElement.h"
+#include "TVirtualMutex.h"
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TTreeReader.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#endif
 
 ClassImp(TSelectorDraw);
 
@@ -908,6 +920,16 @@ void TSelectorDraw::Begin(TTree *tree)
    }
    if (varexp) delete[] varexp;
    if (hnamealloc) delete[] hnamealloc;
+   InitFill();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Initialize the buffers and flags used by ProcessFill, once the variables
+/// are compiled.
+
+void TSelectorDraw::InitFill()
+{
+   Int_t i;
    for (i = 0; i < fValSize; ++i)
       fVarMultiple[i] = kFALSE;
    fSelectMultiple = kFALSE;
@@ -1337,6 +1359,246 @@ void TSelectorDraw::ProcessFillObject(Long64_t /*entry*/)
 
 }
 
+#ifdef R__USE_IMT
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the tree can be read again from its file by another thread.
+
+Bool_t IsInReadOnlyFile(TTree *tree)
+{
+   TFile *file = tree->GetCurrentFile();
+   return file && !file->IsWritable() && tree->GetDirectory() == file;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return in varexp and selection the expressions of the compiled variables
+/// and selection, to be compiled again for another tree.
+
+void GetExpressions(TTreeFormula **vars, Int_t dimension, TTreeFormula *select, TString &varexp, TString &selection)
+{
+   varexp = "";
+   for (Int_t i = 0; i < dimension; ++i) {
+      if (i) varexp += ":";
+      varexp += vars[i]->GetTitle();
+   }
+   selection = select ? select->GetTitle() : "";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The part of a TTree::Draw done by one task of TSelectorDraw::ProcessMT.
+/// The expressions are compiled again for the tree read by the task, and the
+/// values are buffered by ProcessFill as usual. Every kBufferSize values, the
+/// buffer is filled into the object of the drawing selector, with the lock
+/// held. An entry list or event list is instead filled for the task alone,
+/// to be merged at the end of the task.
+
+class TSelectorDrawTask : public TSelectorDraw {
+private:
+   std::mutex &fMutex; // Lock of the object of the drawing selector
+
+public:
+   enum { kBufferSize = 4096 };
+
+   TSelectorDrawTask(TTree *tree, Int_t action, TObject *object, std::mutex &mutex) : fMutex(mutex)
+   {
+      fTree   = tree;
+      fAction = action;
+      fObject = object;
+   }
+
+   Bool_t Compile(const char *varexp, const char *selection) { return CompileVariables(varexp, selection); }
+
+   // The buffers are allocated with the estimate of the tree
+   void Init() { InitFill(); }
+
+   void ProcessFill(Long64_t entry)
+   {
+      TSelectorDraw::ProcessFill(entry);
+      // The entry lists need the number of the entry being processed
+      if (fNfill && (fAction == 5 || fNfill >= kBufferSize)) {
+         TakeAction();
+         fNfill = 0;
+      }
+   }
+
+   void TakeAction()
+   {
+      if (fAction == 5) {
+         TSelectorDraw::TakeAction();
+         return;
+      }
+      std::lock_guard<std::mutex> lock(fMutex);
+      TSelectorDraw::TakeAction();
+   }
+};
+
+} // anonymous namespace
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the remaining entries can be processed in parallel by
+/// ProcessMT. Implicit multi-threading must be enabled (see
+/// ROOT::EnableImplicitMT), the limits of the histogram must be known (which
+/// is the case once the first GetEstimate() values are filled) and:
+///  - the object is a 1-D, 2-D or 3-D histogram or a profile filled with the
+///    values, or an entry list or an event list;
+///  - the variables are numbers, not strings nor objects, and neither they
+///    nor the selection call interpreted functions or methods;
+///  - the expressions can be compiled again, as the tasks do;
+///  - the tree, and its friends, are read from files (a chain of files has
+///    chains of files as friends), without an entry list nor an event list;
+///  - the object is not drawn during the loop (see TTree::SetUpdate).
+
+Bool_t TSelectorDraw::CanProcessMT() const
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fTree || !fObject) return kFALSE;
+   if (fObjEval || fTreeElistArray || fTree->GetUpdate()) return kFALSE;
+   if (fTree->GetEventList() || fTree->GetEntryList()) return kFALSE;
+   for (Int_t i = 0; i < fDimension; ++i) {
+      if (!fVar[i] || fVar[i]->IsString() || fVar[i]->HasMethodCalls()) return kFALSE;
+   }
+   // The interpreter cannot run the calls of several threads
+   if (fSelect && fSelect->HasMethodCalls()) return kFALSE;
+
+   Bool_t isChain = fTree->IsA() == TChain::Class();
+   switch (fAction) {
+      case 1:
+      case 2:
+      case 4:
+      case 23:
+         break;
+      case 3:
+         // A temporary 3-D histogram is not filled
+         if (fObject->TestBit(kCanDelete)) return kFALSE;
+         break;
+      case 5:
+         if (fObject->InheritsFrom(TEntryListArray::Class())) return kFALSE;
+         if (fObject->InheritsFrom(TEntryList::Class())) {
+            // The entries are entered in the list itself, not in sub-lists per tree
+            TEntryList *enlist = (TEntryList*)fObject;
+            if (isChain || enlist->GetLists() || strlen(enlist->GetTreeName()) || strlen(enlist->GetFileName()))
+               return kFALSE;
+         }
+         break;
+      default:
+         return kFALSE;
+   }
+
+   // The tasks read the tree and its friends from their files
+   if (!isChain && !IsInReadOnlyFile(fTree)) return kFALSE;
+   if (TList *friends = fTree->GetListOfFriends()) {
+      TIter next(friends);
+      while (TFriendElement *fe = (TFriendElement*)next()) {
+         TTree *friendTree = fe->GetTree();
+         if (!friendTree || (friendTree->IsA() == TChain::Class()) != isChain) return kFALSE;
+         if (!isChain && !IsInReadOnlyFile(friendTree)) return kFALSE;
+      }
+   }
+
+   // Compile the expressions the tasks compile once, rather than failing in
+   // the tasks after some of the entries are processed
+   TString varexp, selection;
+   GetExpressions(fVar, fDimension, fSelect, varexp, selection);
+   std::mutex mutex;
+   TSelectorDrawTask check(fTree, fAction, fObject, mutex);
+   return check.Compile(varexp, selection);
+#else
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process the entries from firstentry to lastentry (excluded) in parallel,
+/// with ROOT::TTreeProcessorMT, once CanProcessMT() is true.
+///
+/// Each task compiles the variables and the selection for its own copy of the
+/// tree, with the aliases and the weight of the tree. The values are buffered
+/// by the task and filled into the histogram a buffer at a time, with a lock
+/// held: as the histogram is filled in a different order, the limits of an
+/// axis extended both below and above can differ from the ones of a sequential
+/// processing. The entry list or event list of each task is merged into the
+/// list being filled. The arrays returned by GetVal() only hold the values
+/// buffered before the parallel processing started.
+
+void TSelectorDraw::ProcessMT(Long64_t firstentry, Long64_t lastentry)
+{
+#ifdef R__USE_IMT
+   TString varexp, selection;
+   GetExpressions(fVar, fDimension, fSelect, varexp, selection);
+   // The weight of a chain is the one of its trees, unless it is global
+   Bool_t globalWeight = fTree->IsA() != TChain::Class() || fTree->TestBit(TChain::kGlobalWeight);
+
+   std::mutex mutex;
+   std::atomic<bool> failed(false);
+   auto processTask = [&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      std::unique_ptr<TObject> list;
+      std::unique_ptr<TSelectorDrawTask> task;
+      TTree *current = 0;
+      while (reader.Next()) {
+         Long64_t entry = reader.GetCurrentEntry();
+         if (entry < firstentry) continue;
+         if (entry >= lastentry || failed || gROOT->IsInterrupted()) break;
+         if (!task) {
+            if (fAction == 5) {
+               if (fObject->InheritsFrom(TEntryList::Class())) list.reset(new TEntryList());
+               else                                             list.reset(new TEventList());
+            }
+            task.reset(new TSelectorDrawTask(tree, fAction, list ? list.get() : fObject, mutex));
+            R__LOCKGUARD(gROOTMutex);
+            if (globalWeight) tree->SetWeight(fTree->GetWeight(), "global");
+            if (TList *aliases = fTree->GetListOfAliases()) {
+               TIter next(aliases);
+               while (TObject *alias = next()) tree->SetAlias(alias->GetName(), alias->GetTitle());
+            }
+            // The tasks flush their buffers every kBufferSize values, do not
+            // allocate the default estimate of the tree for each of them
+            tree->SetEstimate(TSelectorDrawTask::kBufferSize);
+            if (!task->Compile(varexp, selection)) {
+               failed = true;
+               return;
+            }
+            task->Init();
+         }
+         if (tree->GetTree() != current) {
+            current = tree->GetTree();
+            task->Notify();
+         }
+         task->ProcessFill(current->GetReadEntry());
+      }
+      if (!task) return;
+
+      task->Terminate();
+      std::lock_guard<std::mutex> lock(mutex);
+      fSelectedRows += task->GetSelectedRows();
+      if (list) {
+         if (fObject->InheritsFrom(TEntryList::Class())) {
+            ((TEntryList*)fObject)->Add((TEntryList*)list.get());
+         } else {
+            // TEventList::Add also combines the selections in the title
+            TEventList *evlist = (TEventList*)fObject;
+            TString title = evlist->GetTitle();
+            evlist->Add((TEventList*)list.get());
+            evlist->SetTitle(title);
+         }
+      }
+   };
+
+   ROOT::TTreeProcessorMT processor(*fTree);
+   processor.Process(processTask);
+
+   if (failed) {
+      Error("ProcessMT", "cannot compile the variables for the tree %s", fTree->GetName());
+      Abort("cannot compile the variables", kAbortProcess);
+   }
+#else
+   Error("ProcessMT", "entries %lld to %lld not processed: implicit multi-threading is not supported", firstentry,
+         lastentry);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set number of entries to estimate variable limits.
 
@@ -4410,6 +4410,31 @@ TLeaf *TTreeFormula::GetLeaf(Int_t n) const
    return (TLeaf*)fLeaves.UncheckedAt(n);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the evaluation of the formula, or of one of the aliases and
+/// variable indices it uses, calls functions or methods through the
+/// interpreter (TMethodCall), as in `myfunc(x)` or `obj.GetValue()`.
+
+Bool_t TTreeFormula::HasMethodCalls() const
+{
+   if (fFunctions.GetLast() >= 0) return kTRUE;
+   for (Int_t i = 0; i <= fDataMembers.GetLast(); ++i) {
+      for (TFormLeafInfo *info = (TFormLeafInfo*)fDataMembers.UncheckedAt(i); info; info = info->fNext) {
+         if (dynamic_cast<TFormLeafInfoMethod*>(info)) return kTRUE;
+      }
+   }
+   for (Int_t i = 0; i <= fAliases.GetLast(); ++i) {
+      TTreeFormula *alias = (TTreeFormula*)fAliases.UncheckedAt(i);
+      if (alias && alias->HasMethodCalls()) return kTRUE;
+   }
+   for (Int_t i = 0; i < fNcodes; ++i) {
+      for (Int_t k = 0; k < fNdimensions[i] && k < kMAXFORMDIM; ++k) {
+         if (fVarIndexes[i][k] && fVarIndexes[i][k]->HasMethodCalls()) return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return methodcall corresponding to code.
 ///
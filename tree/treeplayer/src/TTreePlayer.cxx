@@ -2284,7 +2284,22 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
       fSelectorUpdate = selector;
       UpdateFormulaLeaves();
 
+#ifdef R__USE_IMT
+      // In TTree::Draw, once the first values are filled, the remaining
+      // entries may be processed in parallel (see TSelectorDraw::ProcessMT)
+      Bool_t drawMT = (selector == fSelector && ROOT::IsImplicitMTEnabled());
+#endif
+
       for (entry=firstentry;entry<firstentry+nentries;entry++) {
+#ifdef R__USE_IMT
+         if (drawMT && fSelector->GetSelectedRows() > 0) {
+            drawMT = kFALSE;
+            if (fSelector->CanProcessMT()) {
+               fSelector->ProcessMT(entry, firstentry+nentries);
+               break;
+            }
+         }
+#endif
          entryNumber = fTree->GetEntryNumber(entry);
          if (entryNumber < 0) break;
          if (timer && timer->ProcessEvents()) break;
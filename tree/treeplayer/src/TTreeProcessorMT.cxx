@@ -22,14 +22,24 @@ The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+Optionally, clusters much larger than the average workload are split in smaller subranges,
+so that the last tasks to run are not a few oversized clusters keeping one thread busy
+while the others are idle (see SetTasksPerWorkerHint()). The tasks are scheduled by the
+work-stealing ROOT::TThreadExecutor: idle threads take over the work of the busy ones,
+while each thread still runs mostly consecutive subranges of the same file.
 */
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 
+#include <algorithm>
+
 using namespace ROOT;
 
+std::atomic<unsigned int> TTreeProcessorMT::fgTasksPerWorkerHint(0U);
+
 ////////////////////////////////////////////////////////////////////////
 /// Constructor based on a file name.
 /// \param[in] filename Name of the file containing the tree to process.
@@ -82,7 +92,25 @@ std::vector<ROOT::Internal::TreeViewCluster> TTreeProcessorMT::MakeClusters()
       }
       offset += entries;
    }
-   return clusters;
+
+   // If requested, split the clusters with more entries than a task should process on average. The
+   // subranges of a cluster read the same baskets, hence clusters smaller than that are left as they are.
+   const unsigned int tasksPerWorker = fgTasksPerWorkerHint;
+   if (tasksPerWorker == 0U)
+      return clusters;
+   const auto nTasks = std::max(1U, ROOT::GetImplicitMTPoolSize()) * tasksPerWorker;
+   const Long64_t maxTaskEntries = std::max(1LL, (offset + nTasks - 1) / nTasks);
+   std::vector<ROOT::Internal::TreeViewCluster> tasks;
+   tasks.reserve(clusters.size());
+   for (const auto &c : clusters) {
+      const Long64_t nEntries = c.endEntry - c.startEntry;
+      const Long64_t nSplits = (nEntries + maxTaskEntries - 1) / maxTaskEntries;
+      for (Long64_t i = 0; i < nSplits; ++i) {
+         tasks.emplace_back(ROOT::Internal::TreeViewCluster{c.startEntry + i * nEntries / nSplits,
+                                                             c.startEntry + (i + 1) * nEntries / nSplits});
+      }
+   }
+   return tasks;
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -116,6 +144,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       auto readerAndEntryList = treeView->GetTreeReader(c.startEntry, c.endEntry);
       auto &reader = std::get<0>(readerAndEntryList);
       func(*reader);
+      treeView->ReturnTreeReader(std::move(readerAndEntryList));
 
       // In case of task interleaving, we need to load here the tree of the parent task
       treeView->RestoreLoadedEntry();
@@ -125,3 +154,24 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    TThreadExecutor pool;
    pool.Foreach(mapFunction, clusters);
 }
+
+////////////////////////////////////////////////////////////////////////
+/// Set the number of tasks per worker thread that the entries to process
+/// are divided into. Clusters with more entries than
+/// `entries / (nWorkers * nTasks)` are split in subranges of at most that
+/// size, so that the threads finish at about the same time; since the
+/// subranges of a cluster decompress the same baskets, a larger value
+/// trades some redundant reading for a better balance. A value of 0, the
+/// default, never splits a cluster: each task processes one cluster.
+/// \param[in] nTasks Number of tasks per worker thread.
+void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int nTasks)
+{
+   fgTasksPerWorkerHint = nTasks;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Get the number of tasks per worker thread, see SetTasksPerWorkerHint().
+unsigned int TTreeProcessorMT::GetTasksPerWorkerHint()
+{
+   return fgTasksPerWorkerHint;
+}
@@ -397,7 +397,13 @@ TTreeReader::EEntryStatus TTreeReader::SetEntryBase(Long64_t entry, Bool_t local
       // invalidating iterators. Use old-school counting instead.
       for (size_t i = 0; i < fValues.size(); ++i) {
          ROOT::Internal::TTreeReaderValueBase* reader = fValues[i];
-         reader->CreateProxy();
+         if (reader->GetProxy()) {
+            // Set up before, e.g. attached again after TTreeReaderValueBase::DetachFromTreeReader():
+            // the tree might have changed in the meantime.
+            reader->NotifyNewTree(fTree->GetTree());
+         } else {
+            reader->CreateProxy();
+         }
 
          if (!reader->GetProxy()){
             fEntryStatus = kEntryDictionaryError;
@@ -219,6 +219,16 @@ namespace {
             return *GetSizeReader<UInt_t>();
          return *GetSizeReader<Int_t>();
       }
+
+      void DetachFromTreeReader() override {
+         if (fSizeReader)
+            fSizeReader->DetachFromTreeReader();
+      }
+
+      void AttachToTreeReader(TTreeReader* treeReader) override {
+         if (fSizeReader)
+            fSizeReader->AttachToTreeReader(treeReader);
+      }
    };
 
    class TArrayParameterSizeReader: public TUIntOrIntReader<TObjectArrayReader> {
@@ -522,6 +532,28 @@ bool ROOT::Internal::TTreeReaderArrayBase::GetBranchAndLeaf(TBranch* &branch, TL
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Detach from the tree reader, together with the reader of the array size if
+/// there is one.
+
+void ROOT::Internal::TTreeReaderArrayBase::DetachFromTreeReader()
+{
+   TTreeReaderValueBase::DetachFromTreeReader();
+   if (fImpl)
+      fImpl->DetachFromTreeReader();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Attach again to the tree reader, together with the reader of the array size
+/// if there is one.
+
+void ROOT::Internal::TTreeReaderArrayBase::AttachToTreeReader(TTreeReader* reader)
+{
+   TTreeReaderValueBase::AttachToTreeReader(reader);
+   if (fImpl)
+      fImpl->AttachToTreeReader(reader);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create the TVirtualCollectionReader object for our branch.
 
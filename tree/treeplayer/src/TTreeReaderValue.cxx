@@ -118,6 +118,30 @@ void ROOT::Internal::TTreeReaderValueBase::RegisterWithTreeReader() {
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Deregister from the tree reader without losing the setup of the branch: the
+/// branch proxy stays with the tree reader, which owns it. The value reader is
+/// not notified of new trees until it is registered again with the same tree
+/// reader through AttachToTreeReader().
+
+void ROOT::Internal::TTreeReaderValueBase::DetachFromTreeReader() {
+   if (fTreeReader) {
+      fTreeReader->DeregisterValueReader(this);
+      fTreeReader = nullptr;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register again with the tree reader this value reader was detached from,
+/// which must still exist, before its next entry loop (e.g. after
+/// TTreeReader::Restart()). The branch proxy is kept; the leaf is looked up
+/// again when the first entry is loaded, in case the tree has changed.
+
+void ROOT::Internal::TTreeReaderValueBase::AttachToTreeReader(TTreeReader* reader) {
+   fTreeReader = reader;
+   RegisterWithTreeReader();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Try to read the value from the TBranchProxy, returns
 /// the status of the read.
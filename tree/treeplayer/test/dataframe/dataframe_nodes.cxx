@@ -1,9 +1,14 @@
 #include <ROOT/TDataFrame.hxx>
 #include <ROOT/TDFNodes.hxx>
+#include <TChain.h>
+#include <TFile.h>
 #include <TSystem.h>
+#include <TTree.h>
+#include <TTreeReader.h>
 
 #include <mutex>
 #include <thread>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -68,6 +73,92 @@ TEST(TDataFrameNodes, TSlotStackPutBackTooMany)
 
 #endif
 
+// Access to the branch proxies of a TTreeReader
+struct TTreeReaderProxies : public TTreeReader {
+   static Int_t Count(TTreeReader &r) { return (r.*(&TTreeReaderProxies::GetProxies))()->GetSize(); }
+};
+
+TEST(TDataFrameNodes, TValueReaderCacheReuseAcrossTasks)
+{
+   // A chain of two trees of 10 entries
+   const char *fileNames[] = {"dataframe_nodes_cache_0.root", "dataframe_nodes_cache_1.root"};
+   Long64_t i = 0;
+   for (auto fileName : fileNames) {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int n = 0;
+      int a[3];
+      t.Branch("i", &i);
+      t.Branch("n", &n);
+      t.Branch("a", a, "a[n]/I");
+      for (auto e = 0; e < 10; ++e, ++i) {
+         n = i % 3 + 1;
+         for (auto k = 0; k < n; ++k)
+            a[k] = i + k;
+         t.Fill();
+      }
+      t.Write();
+   }
+   TChain c("t");
+   for (auto fileName : fileNames)
+      c.Add(fileName);
+   TTreeReader r(&c);
+
+   using ValueCache_t = ROOT::Internal::TDF::TValueReaderCache<TTreeReaderValue<Long64_t>>;
+   using ArrayCache_t = ROOT::Internal::TDF::TValueReaderCache<TTreeReaderArray<int>>;
+   using Readers_t = std::pair<TTreeReaderValue<Long64_t> *, TTreeReaderArray<int> *>;
+
+   // Read the entries [begin, end) with the value readers of a slot, as a task of TTreeProcessorMT does
+   auto runTask = [&r](ValueCache_t &values, ArrayCache_t &arrays, Long64_t begin, Long64_t end) {
+      r.Restart();
+      r.SetEntriesRange(begin, end);
+      auto value = values.Get(r, "i");
+      auto array = arrays.Get(r, "a");
+      const Readers_t readers(value.get(), array.get());
+      while (r.Next()) {
+         const auto entry = r.GetCurrentEntry();
+         EXPECT_EQ(**value, entry);
+         EXPECT_EQ(array->GetSize(), std::size_t(entry % 3 + 1));
+         for (auto k = 0u; k < array->GetSize(); ++k)
+            EXPECT_EQ((*array)[k], entry + k);
+      }
+      values.Release(std::move(value));
+      arrays.Release(std::move(array));
+      return readers;
+   };
+
+   ValueCache_t values, otherValues;
+   ArrayCache_t arrays, otherArrays;
+   const auto readers = runTask(values, arrays, 0, 5);
+   const auto nProxies = TTreeReaderProxies::Count(r);
+   EXPECT_EQ(values.GetSize(), 1u);
+   EXPECT_EQ(arrays.GetSize(), 1u);
+   // Detached: not notified while the TTreeReader is used by the tasks of other slots
+   EXPECT_EQ(readers.first->GetTreeReader(), nullptr);
+   EXPECT_EQ(readers.second->GetTreeReader(), nullptr);
+
+   // Another slot: other value readers, the same proxies
+   EXPECT_NE(runTask(otherValues, otherArrays, 5, 10), readers);
+   EXPECT_EQ(TTreeReaderProxies::Count(r), nProxies);
+
+   // No new value readers nor proxies for the next task of the slot on the same tree
+   EXPECT_EQ(runTask(values, arrays, 2, 8), readers);
+   EXPECT_EQ(TTreeReaderProxies::Count(r), nProxies);
+
+   // Nor when the TTreeReader has moved to the next tree in the meantime, or back to the first one
+   runTask(otherValues, otherArrays, 8, 12);
+   EXPECT_EQ(runTask(values, arrays, 12, 20), readers);
+   EXPECT_EQ(runTask(values, arrays, 0, 10), readers);
+   EXPECT_EQ(TTreeReaderProxies::Count(r), nProxies);
+   EXPECT_EQ(values.GetSize(), 1u);
+
+   values.Clear();
+   EXPECT_EQ(values.GetSize(), 0u);
+
+   for (auto fileName : fileNames)
+      gSystem->Unlink(fileName);
+}
+
 TEST(TDataFrameNodes, TLoopManagerGetImplPtr)
 {
    ROOT::Detail::TDF::TLoopManager lm(nullptr, {});
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <ROOT/TDataFrame.hxx>
 #include <ROOT/TSeq.hxx>
+#include <TChain.h>
 #include <TFile.h>
 #include <TGraph.h>
 #include <TInterpreter.h>
@@ -12,6 +13,7 @@
 
 #include <algorithm> // std::sort
 #include <chrono>
+#include <list>
 #include <thread>
 #include <set>
 
@@ -388,6 +390,40 @@ TEST_P(TDFSimpleTests, CArraysFromTree)
    EXPECT_EQ(20, h_jit->GetEntries());
 }
 
+TEST_P(TDFSimpleTests, ChainWithMoreTasksThanSlots)
+{
+   // One event per cluster: in MT runs, every thread processes many tasks and the
+   // tree readers are handed from task to task across the trees of the chain
+   const auto treeName = "t";
+   const auto nFiles = 4u;
+   const auto nEvents = 64u;
+   TChain c(treeName);
+   std::vector<std::string> fileNames;
+   for (auto i = 0u; i < nFiles; ++i) {
+      fileNames.emplace_back("dataframe_simple_chain" + std::to_string(i) + ".root");
+      FillTree(fileNames.back().c_str(), treeName, nEvents);
+      c.Add(fileNames.back().c_str());
+   }
+
+   TDataFrame d(c);
+   auto f = d.Filter([](unsigned int n, TVec<int> &b4) { return b4.size() == n && b4[0] == 21; }, {"n", "b4"});
+   auto b1 = f.Take<double>("b1");
+   auto sumb2 = f.Sum<int>("b2");
+   auto count = f.Filter([](TVec<double> &b3, double b1) { return b3[0] == b1 && b3[1] == -b1; }, {"b3", "b1"})
+                   .Count();
+
+   std::vector<double> entries(*b1);
+   std::sort(entries.begin(), entries.end());
+   ASSERT_EQ(entries.size(), nFiles * nEvents);
+   for (auto i = 0u; i < nFiles * nEvents; ++i)
+      EXPECT_DOUBLE_EQ(entries[i], i / nFiles);
+   EXPECT_EQ(*sumb2, int(nFiles * (nEvents - 1) * nEvents * (2 * nEvents - 1) / 6));
+   EXPECT_EQ(*count, nFiles * nEvents);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
 TEST_P(TDFSimpleTests, TakeCarrays)
 {
    auto treeName = "t";
@@ -481,6 +517,62 @@ TEST_P(TDFSimpleTests, AggregateGraph)
    }
 }
 
+TEST_P(TDFSimpleTests, LargeHisto3D)
+{
+   // The slots share a histogram, filled concurrently rather than through one clone per slot, if the clones would
+   // have more than kMinConcurrentFillCells cells in total: the 130^3 cells of this one need the 4 slots of the fixture
+   const ::TH3D model("h", "h", 128, 0, 1, 128, 0, 1, 128, 0, 1);
+   if (GetParam()) {
+      ASSERT_EQ(ROOT::Internal::TDF::GetNSlots(), NSLOTS);
+      ASSERT_GT(model.GetNcells() * Long64_t(NSLOTS), ROOT::Internal::TDF::kMinConcurrentFillCells);
+   }
+
+   auto d = TDataFrame(10000)
+               .DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return (e % 997) / 997.; })
+               .Define("y", [](double x) { return x * x; }, {"x"})
+               .Define("z", [](double x) { return 1. - x; }, {"x"})
+               .Define("w", [](double x) { return x < 0.5 ? 1. : 2.; }, {"x"})
+               .Define("v", [](double x) { return std::vector<double>{x, 1. - x}; }, {"x"});
+   auto h = d.Histo3D(model, "x", "y", "z", "w");
+   auto hv = d.Histo3D(model, "v", "v", "v");
+
+   ::TH3D href(model), hvref(model);
+   for (ULong64_t e = 0; e < 10000; ++e) {
+      const double x = (e % 997) / 997.;
+      href.Fill(x, x * x, 1. - x, x < 0.5 ? 1. : 2.);
+      hvref.Fill(x, x, x);
+      hvref.Fill(1. - x, 1. - x, 1. - x);
+   }
+   EXPECT_EQ(href.GetEntries(), h->GetEntries());
+   EXPECT_EQ(hvref.GetEntries(), hv->GetEntries());
+   for (int bin = 0; bin < href.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(href.GetBinContent(bin), h->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(hvref.GetBinContent(bin), hv->GetBinContent(bin));
+   }
+}
+
+TEST_P(TDFSimpleTests, LargeHisto3DFromList)
+{
+   // Containers without random access, such as std::list, can fill the histogram shared by the slots as well
+   const ::TH3D model("h", "h", 128, 0, 1, 128, 0, 1, 128, 0, 1);
+   using List_t = std::list<double>;
+   auto d = TDataFrame(10000)
+               .DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return (e % 997) / 997.; })
+               .Define("l", [](double x) { return List_t{x, 1. - x}; }, {"x"})
+               .Define("w", [](double x) { return List_t{1., x < 0.5 ? 1. : 2.}; }, {"x"});
+   auto h = d.Histo3D<List_t, List_t, List_t, List_t>(model, "l", "l", "l", "w");
+
+   ::TH3D href(model);
+   for (ULong64_t e = 0; e < 10000; ++e) {
+      const double x = (e % 997) / 997.;
+      href.Fill(x, x, x, 1.);
+      href.Fill(1. - x, 1. - x, 1. - x, x < 0.5 ? 1. : 2.);
+   }
+   EXPECT_EQ(href.GetEntries(), h->GetEntries());
+   for (int bin = 0; bin < href.GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(href.GetBinContent(bin), h->GetBinContent(bin));
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_CASE_P(Seq, TDFSimpleTests, ::testing::Values(false));
 
@@ -1,5 +1,6 @@
 #include "ROOT/TDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "RConfigure.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TSystem.h"
@@ -186,7 +187,11 @@ void test_snapshot_options(TInterface<TLoopManager> &tdf)
    opts.fCompressionLevel = 6;
 
    const auto outfile = "snapshot_test_opts.root";
+#ifdef R__HAS_ZSTD
+   for (auto algorithm : {ROOT::kZLIB, ROOT::kLZMA, ROOT::kLZ4, ROOT::kZSTD}) {
+#else
    for (auto algorithm : {ROOT::kZLIB, ROOT::kLZMA, ROOT::kLZ4}) {
+#endif
       opts.fCompressionAlgorithm = algorithm;
 
       auto s = tdf.Snapshot<int>("t", outfile, {"ans"}, opts);
@@ -0,0 +1,117 @@
+#include "TEntryList.h"
+#include "TEventList.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TInterpreter.h"
+#include "TProfile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#ifdef R__USE_IMT
+
+static const char *kDrawMTFile = "drawmt.root";
+
+class TTreeDrawMT : public ::testing::Test {
+protected:
+   static void SetUpTestCase()
+   {
+      TFile f(kDrawMTFile, "RECREATE");
+      TTree t("t", "t");
+      double x = 0.;
+      int i = 0;
+      t.Branch("x", &x);
+      t.Branch("i", &i);
+      t.SetAutoFlush(1000);
+      for (i = 0; i < 100000; ++i) {
+         x = 0.001 * (i % 7919);
+         t.Fill();
+      }
+      t.Write();
+   }
+   static void TearDownTestCase() { gSystem->Unlink(kDrawMTFile); }
+};
+
+TEST_F(TTreeDrawMT, Histograms)
+{
+   TFile f(kDrawMTFile);
+   TTree *t = static_cast<TTree *>(f.Get("t"));
+   t->SetEstimate(1000);
+
+   t->Draw("x>>h1seq", "i%3", "goff");
+   t->Draw("x:i>>h2seq(100,0,100000,100,0,8)", "", "goff");
+   t->Draw("x:i>>pseq(100,0,100000)", "", "prof goff");
+   ROOT::EnableImplicitMT(4u);
+   EXPECT_EQ(t->Draw("x>>h1mt", "i%3", "goff"), 66666);
+   t->Draw("x:i>>h2mt(100,0,100000,100,0,8)", "", "goff");
+   t->Draw("x:i>>pmt(100,0,100000)", "", "prof goff");
+   ROOT::DisableImplicitMT();
+
+   auto h1seq = static_cast<TH1 *>(gDirectory->Get("h1seq"));
+   auto h1mt = static_cast<TH1 *>(gDirectory->Get("h1mt"));
+   ASSERT_EQ(h1seq->GetNbinsX(), h1mt->GetNbinsX());
+   for (Int_t bin = 0; bin <= h1seq->GetNbinsX() + 1; ++bin)
+      EXPECT_DOUBLE_EQ(h1seq->GetBinContent(bin), h1mt->GetBinContent(bin));
+   EXPECT_DOUBLE_EQ(h1seq->GetEntries(), h1mt->GetEntries());
+
+   auto h2seq = static_cast<TH2 *>(gDirectory->Get("h2seq"));
+   auto h2mt = static_cast<TH2 *>(gDirectory->Get("h2mt"));
+   for (Int_t bin = 0; bin < h2seq->GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(h2seq->GetBinContent(bin), h2mt->GetBinContent(bin));
+
+   auto pseq = static_cast<TProfile *>(gDirectory->Get("pseq"));
+   auto pmt = static_cast<TProfile *>(gDirectory->Get("pmt"));
+   for (Int_t bin = 0; bin <= pseq->GetNbinsX() + 1; ++bin) {
+      EXPECT_NEAR(pseq->GetBinContent(bin), pmt->GetBinContent(bin), 1e-9);
+      EXPECT_DOUBLE_EQ(pseq->GetBinEntries(bin), pmt->GetBinEntries(bin));
+   }
+}
+
+TEST_F(TTreeDrawMT, Lists)
+{
+   TFile f(kDrawMTFile);
+   TTree *t = static_cast<TTree *>(f.Get("t"));
+   t->SetEstimate(1000);
+
+   ROOT::EnableImplicitMT(4u);
+   t->Draw(">>elist", "i%5==0", "entrylist");
+   t->Draw(">>evlist", "i%5==0");
+   ROOT::DisableImplicitMT();
+
+   auto elist = static_cast<TEntryList *>(gDirectory->Get("elist"));
+   auto evlist = static_cast<TEventList *>(gDirectory->Get("evlist"));
+   ASSERT_EQ(elist->GetN(), 20000);
+   ASSERT_EQ(evlist->GetN(), 20000);
+   for (Long64_t i = 0; i < 100000; ++i) {
+      EXPECT_EQ(elist->Contains(i), i % 5 == 0);
+      EXPECT_EQ(evlist->Contains(i), i % 5 == 0);
+   }
+   for (Int_t i = 1; i < evlist->GetN(); ++i)
+      EXPECT_LT(evlist->GetEntry(i - 1), evlist->GetEntry(i));
+}
+
+TEST_F(TTreeDrawMT, InterpretedFunctions)
+{
+   TFile f(kDrawMTFile);
+   TTree *t = static_cast<TTree *>(f.Get("t"));
+   t->SetEstimate(1000);
+   gInterpreter->Declare("double drawmtTwice(double x) { return 2. * x; }");
+
+   // The entries are processed sequentially
+   t->Draw("drawmtTwice(x)>>hfseq", "i%3", "goff");
+   ROOT::EnableImplicitMT(4u);
+   EXPECT_EQ(t->Draw("drawmtTwice(x)>>hfmt", "i%3", "goff"), 66666);
+   EXPECT_EQ(t->Draw("x>>hsmt", "drawmtTwice(i%3)", "goff"), 66666);
+   ROOT::DisableImplicitMT();
+
+   auto hfseq = static_cast<TH1 *>(gDirectory->Get("hfseq"));
+   auto hfmt = static_cast<TH1 *>(gDirectory->Get("hfmt"));
+   ASSERT_EQ(hfseq->GetNbinsX(), hfmt->GetNbinsX());
+   for (Int_t bin = 0; bin <= hfseq->GetNbinsX() + 1; ++bin)
+      EXPECT_DOUBLE_EQ(hfseq->GetBinContent(bin), hfmt->GetBinContent(bin));
+}
+
+#endif // R__USE_IMT
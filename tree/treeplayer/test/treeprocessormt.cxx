@@ -0,0 +1,108 @@
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderValue.h"
+
+#include "gtest/gtest.h"
+
+#ifdef R__USE_IMT
+
+#include "ROOT/TTreeProcessorMT.hxx"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+static const char *kTreeProcessorMTFiles[] = {"treeprocessormt_0.root", "treeprocessormt_1.root"};
+static const Long64_t kTreeProcessorMTEntries = 20000;
+
+class TTreeProcessorMTTest : public ::testing::Test {
+protected:
+   // Two files with a large cluster and a small one each
+   static void SetUpTestCase()
+   {
+      Long64_t entry = 0;
+      for (auto fileName : kTreeProcessorMTFiles) {
+         TFile f(fileName, "RECREATE");
+         TTree t("t", "t");
+         Long64_t e = 0;
+         t.Branch("e", &e);
+         t.SetAutoFlush(8000);
+         for (Long64_t i = 0; i < kTreeProcessorMTEntries / 2; ++i) {
+            e = entry++;
+            t.Fill();
+         }
+         t.Write();
+      }
+   }
+   static void TearDownTestCase()
+   {
+      for (auto fileName : kTreeProcessorMTFiles)
+         gSystem->Unlink(fileName);
+   }
+};
+
+// Process the files with the given tasks per worker hint, check that every
+// entry is read exactly once and return the number of tasks
+static unsigned int CheckEntriesProcessedOnce(unsigned int tasksPerWorker)
+{
+   const auto oldHint = ROOT::TTreeProcessorMT::GetTasksPerWorkerHint();
+   ROOT::TTreeProcessorMT::SetTasksPerWorkerHint(tasksPerWorker);
+
+   std::vector<std::atomic<int>> counts(kTreeProcessorMTEntries);
+   for (auto &c : counts)
+      c = 0;
+   std::atomic<unsigned int> nTasks(0U);
+   std::mutex rangesMutex;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+
+   ROOT::TTreeProcessorMT tp({kTreeProcessorMTFiles[0], kTreeProcessorMTFiles[1]}, "t");
+   tp.Process([&](TTreeReader &r) {
+      TTreeReaderValue<Long64_t> e(r, "e");
+      Long64_t first = -1, last = -1;
+      while (r.Next()) {
+         if (first < 0)
+            first = *e;
+         last = *e;
+         ++counts[*e];
+      }
+      ++nTasks;
+      std::lock_guard<std::mutex> lock(rangesMutex);
+      ranges.emplace_back(first, last);
+   });
+
+   ROOT::TTreeProcessorMT::SetTasksPerWorkerHint(oldHint);
+
+   for (Long64_t i = 0; i < kTreeProcessorMTEntries; ++i)
+      EXPECT_EQ(counts[i].load(), 1) << "entry " << i << ", " << tasksPerWorker << " tasks per worker";
+   // Each task reads a non-empty range of consecutive entries
+   for (const auto &range : ranges) {
+      EXPECT_GE(range.first, 0) << tasksPerWorker << " tasks per worker";
+      EXPECT_LE(range.first, range.second) << tasksPerWorker << " tasks per worker";
+   }
+   return nTasks;
+}
+
+TEST_F(TTreeProcessorMTTest, EntriesProcessedOnce)
+{
+   ROOT::EnableImplicitMT(4u);
+   const auto nWorkers = ROOT::GetImplicitMTPoolSize();
+
+   // One task per cluster: 8000 and 2000 entries per file
+   EXPECT_EQ(CheckEntriesProcessedOnce(0U), 4U);
+
+   // At most 20000 / nWorkers entries per task: the large clusters are split with 4 workers
+   const auto nTasks1 = CheckEntriesProcessedOnce(1U);
+   if (nWorkers >= 4)
+      EXPECT_GT(nTasks1, 4U);
+
+   // At most 2000 entries per task with any number of workers
+   const auto nTasksN = CheckEntriesProcessedOnce(10U);
+   EXPECT_GT(nTasksN, nTasks1);
+
+   ROOT::DisableImplicitMT();
+}
+
+#endif // R__USE_IMT